@@ -6,9 +6,17 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
+#include "DmaBuffer.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -115,14 +123,195 @@ concept IsAdcOutputMax =
     __Internal::__IsRange<T> &&
     std::same_as<typename T::ValueTypeT, double>;
 
+/**
+ * @struct AdcLookupTableSize, A utility struct to configure the number of lookup table segments.
+ *
+ * @tparam SegmentsV    Number of linear segments over the ADC code range (a power of two).
+ *
+ * The table stores SegmentsV + 1 entries of 4 bytes. Doubling the segments
+ * roughly quarters the interpolation error of smooth functions.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using CoarseTable = STM32::AdcLookupTableSize<16>;   // 68 bytes of flash
+ * using FineTable = STM32::AdcLookupTableSize<128>;    // 516 bytes of flash
+ * @endcode
+ */
+template <std::uint32_t SegmentsV>
+struct AdcLookupTableSize : __Internal::__Constant<std::uint32_t, SegmentsV> {
+    static_assert(
+        std::has_single_bit(SegmentsV),
+        "Lookup table segment count must be a power of two!"
+    );
+};
+
+/**
+ * @brief IsAdcLookupTableSize, A concept to check if a type is a AdcLookupTableSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcLookupTableSize<STM32::AdcLookupTableSize<32>>);
+ * static_assert(!STM32::IsAdcLookupTableSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcLookupTableSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    std::has_single_bit(T::value);
+
+/**
+ * @struct AdcLookupTable, A compile-time linearization table for nonlinear sensors.
+ *
+ * The conversion function is evaluated at compile time on SizeT segments
+ * over the ADC code range and stored as a piecewise-linear table in flash.
+ * At runtime a code is converted with a shift, a multiply and an add instead
+ * of evaluating log() or polynomials. Used in AdcConfig in place of
+ * AdcOutputMax, Get() then returns the converted value as std::int32_t.
+ *
+ * @tparam AdcResolutionT   Hardware resolution, must match the AdcConfig resolution.
+ * @tparam SizeT            Number of segments (e.g., AdcLookupTableSize<32>).
+ * @tparam ConversionV      Constexpr callable converting an ADC code (as double) to
+ *                          the output unit (as double), e.g., a captureless lambda.
+ *
+ * @note The conversion function must be evaluable at compile time. GCC folds
+ *       the <cmath> functions such as std::log in constant expressions.
+ * @note Outputs are rounded to integers, scale the output unit for more
+ *       resolution (e.g., 0.01 degrees Celsius).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * // 10k NTC (B = 3950) against a 10k pull-up, output in 0.01 degrees Celsius
+ * using NtcTable = STM32::AdcLookupTable<
+ *     STM32::AdcResolution::Resolution12Bit,
+ *     STM32::AdcLookupTableSize<64>,
+ *     [](double code){
+ *         const double clamped = std::clamp(code, 1., 4094.);
+ *         const double ratio = clamped / (4095. - clamped);
+ *         return 100. * (1. / (1. / 298.15 + std::log(ratio) / 3950.) - 273.15);
+ *     }
+ * >;
+ * // Error below 0.15 degrees Celsius between 85 (code 400) and -18 (code 3700) degrees Celsius
+ * static_assert(NtcTable::MaxError(400, 3700) < 15.);
+ *
+ * using NtcAdcConfig = STM32::AdcConfig<
+ *     NtcTable,
+ *     STM32::AdcResolution::Resolution12Bit,
+ *     STM32::AdcMedianFilterSize<5>,
+ *     STM32::AdcTimeout<100>
+ * >;
+ *
+ * ADC_HandleTypeDef hadc1; // Assume properly initialized by CubeMX
+ * STM32::Adc<NtcAdcConfig> ntc{hadc1};
+ * std::int32_t centi_celsius = ntc.Get();
+ *
+ * // Raw codes from any source can be converted too
+ * auto temperature = NtcTable::Lookup(raw_code);
+ * @endcode
+ */
+template <
+    IsAdcResolution AdcResolutionT,
+    IsAdcLookupTableSize SizeT,
+    auto ConversionV
+>
+struct AdcLookupTable {
+    using InputResolutionT = AdcResolutionT;
+    using OutputT = std::int32_t;
+
+    /**
+     * @brief Convert an ADC code.
+     *
+     * @param adc_value     Raw ADC value, values above the resolution are clamped.
+     *
+     * @returns Interpolated output, rounded to nearest.
+     */
+    [[nodiscard]]
+    static constexpr OutputT Lookup(std::uint32_t adc_value) noexcept
+    {
+        return TableT::Lookup(adc_value);
+    }
+
+    /**
+     * @brief Measure the interpolation error, for checking the table size in a static_assert.
+     *
+     * @param first     First ADC code checked (default is 0).
+     * @param last      Last ADC code checked (default is the resolution).
+     *
+     * @returns Largest absolute difference between Lookup() and the conversion
+     *          function over [first, last], in output units.
+     */
+    [[nodiscard]]
+    static consteval double MaxError(
+        std::uint32_t first = 0,
+        std::uint32_t last = static_cast<std::uint32_t>(AdcResolutionT::resolution)
+    ) noexcept
+    {
+        return TableT::MaxError(first, last);
+    }
+
+private:
+    using TableT = __Internal::__PiecewiseLinearTable<
+        static_cast<std::uint32_t>(AdcResolutionT::resolution), SizeT::value, ConversionV
+    >;
+};
+
+/**
+ * @brief IsAdcLookupTable, A concept to check if a type is a AdcLookupTable.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcLookupTable<STM32::AdcLookupTable<
+ *     STM32::AdcResolution::Resolution12Bit,
+ *     STM32::AdcLookupTableSize<32>,
+ *     [](double code){ return code * code / 4095.; }
+ * >>);
+ * static_assert(!STM32::IsAdcLookupTable<STM32::AdcOutputMax<100>>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcLookupTable =
+    IsAdcResolution<typename T::InputResolutionT> &&
+    std::same_as<typename T::OutputT, std::int32_t> &&
+    requires(std::uint32_t adc_value) {
+        { T::Lookup(adc_value) } -> std::same_as<std::int32_t>;
+    };
+
+/**
+ * @brief IsAdcOutput, A concept to check if a type is a AdcOutputMax or a AdcLookupTable.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcOutput<STM32::AdcOutputMax<100>>);
+ * static_assert(!STM32::IsAdcOutput<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcOutput =
+    IsAdcOutputMax<T> ||
+    IsAdcLookupTable<T>;
+
 /**
  * @struct AdcMedianFilterSize, A utility struct to configure median filter size.
  * 
  * @tparam SizeV    Number of samples for median filtering (must be odd and >= 1).
  *
- * The median filter reduces noise by taking multiple ADC readings, sorting them,
- * and returning the middle value. Larger sizes provide better noise rejection
- * but increase read time.
+ * The median filter reduces noise by taking multiple ADC readings and returning
+ * the middle value. Larger sizes provide better noise rejection but increase
+ * read time.
  *
  * @note Use SizeV=1 to disable filtering (single sample).
  * @note Typical values: 3, 5, 7 for good noise rejection.
@@ -204,7 +393,7 @@ concept IsAdcTimeout =
 /**
  * @struct AdcConfig, A utility struct to bundle all ADC configuration parameters.
  * 
- * @tparam AdcOutputMaxT        Output range configuration (0 to MaxV).
+ * @tparam AdcOutputMaxT        Output range configuration (0 to MaxV) or an AdcLookupTable.
  * @tparam AdcResolutionT       Hardware resolution (8, 10, or 12 bit).
  * @tparam AdcMedianFilterSizeT Median filter sample count.
  * @tparam AdcTimeoutT          Conversion timeout in milliseconds.
@@ -221,7 +410,7 @@ concept IsAdcTimeout =
  * @endcode
  */
 template <
-    IsAdcOutputMax AdcOutputMaxT,
+    IsAdcOutput AdcOutputMaxT,
     IsAdcResolution AdcResolutionT,
     IsAdcMedianFilterSize AdcMedianFilterSizeT,
     IsAdcTimeout AdcTimeoutT
@@ -253,7 +442,7 @@ struct AdcConfig : AdcOutputMaxT, AdcResolutionT, AdcMedianFilterSizeT, AdcTimeo
  */
 template <typename T>
 concept IsAdcConfig =
-    IsAdcOutputMax<typename T::OutputRangeT> &&
+    IsAdcOutput<typename T::OutputRangeT> &&
     IsAdcResolution<typename T::ResolutionT> &&
     IsAdcMedianFilterSize<typename T::MedianFilterSizeT> &&
     IsAdcTimeout<typename T::TimeoutT> &&
@@ -262,7 +451,6 @@ concept IsAdcConfig =
         typename T::ResolutionT;
         typename T::MedianFilterSizeT;
         typename T::TimeoutT;
-        T::OutputRangeT::max_value;
         T::ResolutionT::resolution;
     };
 
@@ -312,7 +500,9 @@ template <
         >
 >
 class Adc {
+    static constexpr bool lookup_table{IsAdcLookupTable<typename AdcConfigT::OutputRangeT>};
 public:
+    using OutputT = std::conditional_t<lookup_table, std::int32_t, std::uint32_t>;
 
     /**
      * @brief Constructor for Adc class.
@@ -370,19 +560,22 @@ public:
     /**
      * @brief Get filtered and scaled ADC value.
      * 
-     * Takes multiple samples (defined by MedianFilterSizeT), sorts them,
-     * and returns the median value scaled to the configured output range.
+     * Takes multiple samples (defined by MedianFilterSizeT) and returns the
+     * median value scaled to the configured output range. The median is
+     * selected with a compile-time generated compare-exchange network for
+     * filter sizes up to 25 and with std::ranges::nth_element above.
      * 
-     * @returns Scaled ADC value (0 to AdcOutputMax), or 0 on error.
+     * @returns Scaled ADC value (0 to AdcOutputMax) or the AdcLookupTable
+     *          output, or 0 on error.
      * 
      * @note Returns 0 if all ADC conversions fail.
      *
      * @note Partial failures are handled gracefully using available samples.
      */
     [[nodiscard]]
-    std::uint32_t Get() const noexcept
+    OutputT Get() const noexcept
     {
-        std::array<std::uint32_t, AdcConfigT::MedianFilterSizeT::value> adc_values{};
+        std::array<OutputT, AdcConfigT::MedianFilterSizeT::value> adc_values{};
         std::size_t filled_size{};
         for (std::size_t i{}; i < adc_values.size(); ++i){
             if (HAL_ADC_Start(&m_handle) != HAL_OK){
@@ -396,31 +589,1334 @@ public:
         if (filled_size == 0){
             return 0;
         }
-        std::ranges::sort(adc_values.begin(), adc_values.begin() + filled_size);
-        return adc_values[filled_size / 2];
+        return __Internal::__Median(adc_values, filled_size);
     }
 
 private:
     ADC_HandleTypeDef& m_handle;
 
+    using OutputRangeT = typename AdcConfigT::OutputRangeT;
+    using ResolutionT = typename AdcConfigT::ResolutionT;
+
+    /**
+     * @brief Conversions use integer fixed-point arithmetic when the output
+     *        range and resolution are whole numbers (all predefined configurations).
+     */
+    static constexpr bool integer_scaling{[](){
+        if constexpr (lookup_table) {
+            return false;
+        } else {
+            return
+                __Internal::__IsWholeUint32(OutputRangeT::min_value) &&
+                __Internal::__IsWholeUint32(OutputRangeT::range_size) &&
+                __Internal::__IsWholeUint32(ResolutionT::resolution) &&
+                __Internal::__FixedPointScale::Fits(
+                    static_cast<std::uint64_t>(ResolutionT::resolution),
+                    static_cast<std::uint64_t>(ResolutionT::resolution),
+                    __Internal::__FixedPointRounding::Nearest
+                );
+        }
+    }()};
+
     /**
      * @brief ConvertToOutput, Converts raw ADC value to configured output range.
      * 
      * @param adc_value     Raw ADC value.
      *
      * @returns Converted ADC output value.
+     *
+     * @note The integer path returns the same results as the floating point
+     *       path for raw values up to the resolution, in a multiply and a shift.
+     * @note A lookup table interpolates its compile-time generated table.
      */
-    constexpr auto ConvertToOutput(double adc_value) const noexcept
+    constexpr OutputT ConvertToOutput(std::uint32_t adc_value) const noexcept
     {
-        const double scaled{
-            (adc_value * AdcConfigT::OutputRangeT::range_size) /
-            AdcConfigT::ResolutionT::resolution
-        };
-        return static_cast<std::uint32_t>(
-            std::round(scaled) + AdcConfigT::OutputRangeT::min_value
-        );
+        if constexpr (lookup_table) {
+            static_assert(
+                std::same_as<typename OutputRangeT::InputResolutionT, ResolutionT>,
+                "Lookup table resolution must match the ADC resolution!"
+            );
+            return OutputRangeT::Lookup(adc_value);
+        } else if constexpr (integer_scaling) {
+            constexpr auto scale = __Internal::__FixedPointScale::Make(
+                static_cast<std::uint64_t>(OutputRangeT::range_size),
+                0,
+                static_cast<std::uint64_t>(ResolutionT::resolution),
+                static_cast<std::uint64_t>(ResolutionT::resolution),
+                __Internal::__FixedPointRounding::Nearest
+            );
+            return static_cast<std::uint32_t>(scale.Apply(adc_value)) +
+                   static_cast<std::uint32_t>(OutputRangeT::min_value);
+        } else {
+            const double scaled{
+                (adc_value * OutputRangeT::range_size) / ResolutionT::resolution
+            };
+            return static_cast<std::uint32_t>(
+                std::round(scaled) + OutputRangeT::min_value
+            );
+        }
+    }
+};
+
+/**
+ * @struct AdcOversampling, A utility struct to configure oversampling and decimation.
+ *
+ * @tparam ExtraBitsV   Extra bits of resolution (0-4). 4^ExtraBitsV conversions are
+ *                      accumulated and shifted right by ExtraBitsV.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * using NoOversampling = STM32::AdcOversampling<0>;    // 1 conversion per result
+ * using Plus2Bits = STM32::AdcOversampling<2>;         // 16 conversions, 14-bit result from a 12-bit ADC
+ * auto ratio = Plus2Bits::ratio; // ratio is 16.
+ * @endcode
+ */
+template <std::uint32_t ExtraBitsV>
+struct AdcOversampling : __Internal::__Constant<std::uint32_t, ExtraBitsV> {
+    static_assert(
+        ExtraBitsV <= 4,
+        "Oversampling can add at most 4 bits (256 conversions)!"
+    );
+    static constexpr std::uint32_t ratio{std::uint32_t{1} << (2 * ExtraBitsV)};
+};
+
+/**
+ * @brief IsAdcOversampling, A concept to check if a type is a AdcOversampling.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcOversampling<STM32::AdcOversampling<2>>);
+ * static_assert(!STM32::IsAdcOversampling<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcOversampling =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    (T::value <= 4) &&
+    requires {
+        T::ratio;
+    };
+
+/**
+ * @def STM32_ADC_HARDWARE_OVERSAMPLING
+ *
+ * @brief 1 if the ADC has a hardware oversampler (e.g., L0, L4, G0, G4, H7), 0 otherwise.
+ *
+ * Derived from the HAL ADC definitions. Without a hardware oversampler,
+ * AdcContinuous accumulates DMA transferred conversions in software.
+ */
+#if defined(ADC_RIGHTBITSHIFT_1) && (defined(ADC_OVERSAMPLING_RATIO_4) || defined(ADC_CFGR2_OVSR))
+#define STM32_ADC_HARDWARE_OVERSAMPLING 1
+#else /* ADC_RIGHTBITSHIFT_1 */
+#define STM32_ADC_HARDWARE_OVERSAMPLING 0
+#endif /* ADC_RIGHTBITSHIFT_1 */
+
+#if STM32_ADC_HARDWARE_OVERSAMPLING
+namespace __Internal {
+
+/**
+ * @brief Oversampler settings in the ADC init structure.
+ *
+ * @param handle    ADC handle.
+ *
+ * @returns Init.Oversample on L0, Init.Oversampling on the other families.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+inline auto& __OversamplingInit(ADC_HandleTypeDef& handle) noexcept
+{
+#if defined(STM32L0xx)
+    return handle.Init.Oversample;
+#else /* STM32L0xx */
+    return handle.Init.Oversampling;
+#endif /* STM32L0xx */
+}
+
+} /* namespace __Internal */
+#endif /* STM32_ADC_HARDWARE_OVERSAMPLING */
+
+/**
+ * @class AdcContinuous, Continuous conversion with optional oversampling.
+ *
+ * The converter is started once and keeps converting, GetRaw() reads the
+ * latest result without restarting it. With AdcOversampling<N>, each result
+ * is the sum of 4^N conversions shifted right by N, adding N bits of
+ * resolution:
+ *  - On ADCs with a hardware oversampler the ratio and shift are programmed
+ *    into the ADC and the data register already holds the decimated result.
+ *  - Elsewhere the DMA writes conversions into a circular window of 4^N
+ *    samples and GetRaw() accumulates the window. Start() masks the DMA
+ *    half and full transfer interrupts, which would otherwise fire every
+ *    4^N / 2 conversions, so only DMA transfer errors interrupt the CPU.
+ *
+ * @tparam OversamplingT    Oversampling configuration (default is AdcOversampling<0>).
+ *
+ * @note AdcContinuous class is non-copyable and non-movable.
+ * @note The ADC must be configured by CubeMX for continuous conversion of a
+ *       single channel with overrun set to overwrite. The software path
+ *       additionally needs DMA continuous requests with a circular, half-word
+ *       DMA stream.
+ * @note The hardware path re-initializes the ADC with HAL_ADC_Init() in Start().
+ * @note The software path reads low until the first 4^N conversions are done.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * ADC_HandleTypeDef hadc1; // Assume continuous conversion by CubeMX
+ *
+ * // 12-bit ADC oversampled to 14 bits
+ * STM32::AdcContinuous<STM32::AdcOversampling<2>> adc{hadc1};
+ * adc.Start();
+ *
+ * while (true) {
+ *     auto raw = adc.GetRaw(); // 0-16383, no start/stop per read
+ * }
+ * @endcode
+ */
+template <IsAdcOversampling OversamplingT = AdcOversampling<0>>
+class AdcContinuous {
+    static constexpr bool software_oversampling{
+        OversamplingT::value > 0 && STM32_ADC_HARDWARE_OVERSAMPLING == 0
+    };
+public:
+
+    /**
+     * @brief Construct AdcContinuous class.
+     *
+     * @param handle    Reference to the ADC handle.
+     *
+     * @note Conversions are not started until Start() is called.
+     */
+    explicit AdcContinuous(ADC_HandleTypeDef& handle) noexcept
+      : m_handle{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    AdcContinuous(const AdcContinuous&) = delete;
+    AdcContinuous& operator=(const AdcContinuous&) = delete;
+    AdcContinuous(AdcContinuous&&) = delete;
+    AdcContinuous& operator=(AdcContinuous&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the AdcContinuous object, stops conversions.
+     */
+    ~AdcContinuous()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Start continuous conversions.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start() noexcept
+    {
+        if constexpr (software_oversampling) {
+            __Internal::__InvalidateDCache(m_samples.data(), sizeof(m_samples));
+            if (HAL_OK != HAL_ADC_Start_DMA(
+                &m_handle,
+                reinterpret_cast<std::uint32_t*>(m_samples.data()),
+                static_cast<std::uint32_t>(m_samples.size())
+            )) {
+                return false;
+            }
+            /* Nothing waits for the window, HAL_ADC_Start_DMA() enabled these for its callbacks */
+            __HAL_DMA_DISABLE_IT(m_handle.DMA_Handle, DMA_IT_HT | DMA_IT_TC);
+            return true;
+        } else {
+            if (!ConfigureOversampler()) {
+                return false;
+            }
+            return (HAL_OK == HAL_ADC_Start(&m_handle));
+        }
+    }
+
+    /**
+     * @brief Stop conversions.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        if constexpr (software_oversampling) {
+            return (HAL_OK == HAL_ADC_Stop_DMA(&m_handle));
+        } else {
+            return (HAL_OK == HAL_ADC_Stop(&m_handle));
+        }
+    }
+
+    /**
+     * @brief Get the latest result without restarting the converter.
+     *
+     * @returns Raw value with OversamplingT::value extra bits of resolution.
+     */
+    [[nodiscard]]
+    std::uint32_t GetRaw() const noexcept
+    {
+        if constexpr (software_oversampling) {
+            __Internal::__InvalidateDCache(m_samples.data(), sizeof(m_samples));
+            std::uint32_t sum{};
+            for (const auto sample : m_samples) {
+                sum += sample;
+            }
+            return sum >> OversamplingT::value;
+        } else {
+            return HAL_ADC_GetValue(&m_handle);
+        }
+    }
+
+private:
+    using SamplesT = std::conditional_t<
+        software_oversampling,
+        DmaBuffer<std::uint16_t, OversamplingT::ratio>,
+        std::monostate
+    >;
+
+    ADC_HandleTypeDef& m_handle;
+    [[no_unique_address]] mutable SamplesT m_samples{};  /**< Written by the DMA */
+
+    /**
+     * @brief Program the hardware oversampler and re-initialize the ADC.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool ConfigureOversampler() noexcept
+    {
+#if STM32_ADC_HARDWARE_OVERSAMPLING
+        if constexpr (OversamplingT::value > 0) {
+            constexpr std::array<std::uint32_t, 5> right_shifts{
+                ADC_RIGHTBITSHIFT_NONE, ADC_RIGHTBITSHIFT_1, ADC_RIGHTBITSHIFT_2,
+                ADC_RIGHTBITSHIFT_3, ADC_RIGHTBITSHIFT_4
+            };
+            auto& oversampling = __Internal::__OversamplingInit(m_handle);
+#if defined(ADC_OVERSAMPLING_RATIO_4)
+            constexpr std::array<std::uint32_t, 5> ratios{
+                0, ADC_OVERSAMPLING_RATIO_4, ADC_OVERSAMPLING_RATIO_16,
+                ADC_OVERSAMPLING_RATIO_64, ADC_OVERSAMPLING_RATIO_256
+            };
+            oversampling.Ratio = ratios[OversamplingT::value];
+#else /* ADC_OVERSAMPLING_RATIO_4 */
+            oversampling.Ratio = OversamplingT::ratio;
+#endif /* ADC_OVERSAMPLING_RATIO_4 */
+            oversampling.RightBitShift = right_shifts[OversamplingT::value];
+            m_handle.Init.OversamplingMode = ENABLE;
+            return (HAL_OK == HAL_ADC_Init(&m_handle));
+        }
+#endif /* STM32_ADC_HARDWARE_OVERSAMPLING */
+        return true;
+    }
+};
+
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+/**
+ * @struct AdcScanChannelCount, A utility struct to hold the number of channels in the scan sequence.
+ *
+ * @tparam ChannelCountV    Number of ranks configured in the regular sequence (1-16).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * using MyChannels = STM32::AdcScanChannelCount<4>;
+ * auto count = MyChannels::value; // count is 4.
+ * @endcode
+ */
+template <std::size_t ChannelCountV>
+struct AdcScanChannelCount : __Internal::__Constant<std::size_t, ChannelCountV> {
+    static_assert(
+        1 <= ChannelCountV && ChannelCountV <= 16,
+        "Channel count must be between 1 and 16!"
+    );
+};
+
+/**
+ * @brief IsAdcScanChannelCount, A concept to check if a type is a AdcScanChannelCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcScanChannelCount<STM32::AdcScanChannelCount<4>>);
+ * static_assert(!STM32::IsAdcScanChannelCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcScanChannelCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value) &&
+    (T::value <= 16);
+
+/**
+ * @struct AdcScanBlockSize, A utility struct to hold the number of scan sequences per block.
+ *
+ * @tparam BlockSizeV   Sequences converted per half of the circular DMA buffer.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * using MyBlock = STM32::AdcScanBlockSize<64>;
+ * auto size = MyBlock::value; // size is 64.
+ * @endcode
+ */
+template <std::size_t BlockSizeV>
+struct AdcScanBlockSize : __Internal::__Constant<std::size_t, BlockSizeV> {
+    static_assert(
+        BlockSizeV > 0,
+        "Block size must be greater than zero!"
+    );
+};
+
+/**
+ * @brief IsAdcScanBlockSize, A concept to check if a type is a AdcScanBlockSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcScanBlockSize<STM32::AdcScanBlockSize<64>>);
+ * static_assert(!STM32::IsAdcScanBlockSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcScanBlockSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0;
+
+/**
+ * @brief De-interleave scan sequences into per-channel sample runs.
+ *
+ * The DMA stores one sequence after another (ch0, ch1, ..., ch0, ch1, ...).
+ * The output holds all samples of channel 0, then all samples of channel 1,
+ * and so on.
+ *
+ * @tparam ChannelCountV    Number of channels per sequence.
+ * @tparam SampleCountV     Number of sequences.
+ *
+ * @param interleaved       Samples in conversion order.
+ * @param deinterleaved     Samples grouped by channel.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * std::array<std::uint16_t, 6> raw{1, 10, 2, 20, 3, 30};
+ * std::array<std::uint16_t, 6> grouped{};
+ * STM32::AdcDeinterleave<2, 3>(raw, grouped); // grouped is {1, 2, 3, 10, 20, 30}.
+ * @endcode
+ */
+template <std::size_t ChannelCountV, std::size_t SampleCountV>
+constexpr void AdcDeinterleave(
+    std::span<const std::uint16_t, ChannelCountV * SampleCountV> interleaved,
+    std::span<std::uint16_t, ChannelCountV * SampleCountV> deinterleaved
+) noexcept
+{
+    for (std::size_t sample{}; sample < SampleCountV; ++sample) {
+        for (std::size_t channel{}; channel < ChannelCountV; ++channel) {
+            deinterleaved[channel * SampleCountV + sample] =
+                interleaved[sample * ChannelCountV + channel];
+        }
+    }
+}
+
+static_assert(
+    [](){
+        constexpr std::array<std::uint16_t, 6> interleaved{1, 10, 2, 20, 3, 30};
+        std::array<std::uint16_t, 6> deinterleaved{};
+        AdcDeinterleave<2, 3>(interleaved, deinterleaved);
+        return deinterleaved == std::array<std::uint16_t, 6>{1, 2, 3, 10, 20, 30};
+    }(),
+    "AdcDeinterleave must group two channels by channel"
+);
+static_assert(
+    [](){
+        constexpr std::array<std::uint16_t, 6> interleaved{1, 10, 100, 2, 20, 200};
+        std::array<std::uint16_t, 6> deinterleaved{};
+        AdcDeinterleave<3, 2>(interleaved, deinterleaved);
+        return deinterleaved == std::array<std::uint16_t, 6>{1, 2, 10, 20, 100, 200};
+    }(),
+    "AdcDeinterleave must group three channels by channel"
+);
+static_assert(
+    [](){
+        constexpr std::array<std::uint16_t, 3> interleaved{7, 8, 9};
+        std::array<std::uint16_t, 3> single_channel{};
+        std::array<std::uint16_t, 3> single_sample{};
+        AdcDeinterleave<1, 3>(interleaved, single_channel);
+        AdcDeinterleave<3, 1>(interleaved, single_sample);
+        return single_channel == interleaved && single_sample == interleaved;
+    }(),
+    "AdcDeinterleave must keep a single channel or a single sequence unchanged"
+);
+
+namespace __Internal {
+
+template <
+    __IsUniqueTag UniqueTagT,
+    IsAdcScanChannelCount ChannelCountT,
+    IsAdcScanBlockSize BlockSizeT,
+    typename BlockT
+>
+class __AdcDmaBlocks;
+
+} /* namespace __Internal */
+
+/**
+ * @class AdcScanBlock, A block of scan sequences grouped by channel.
+ *
+ * @tparam ChannelCountT    Number of channels per sequence.
+ * @tparam BlockSizeT       Number of sequences in the block.
+ */
+template <IsAdcScanChannelCount ChannelCountT, IsAdcScanBlockSize BlockSizeT>
+class AdcScanBlock {
+public:
+
+    /**
+     * @returns Number of samples per channel.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Size() noexcept
+    {
+        return BlockSizeT::value;
+    }
+
+    /**
+     * @returns Number of channels.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t ChannelCount() noexcept
+    {
+        return ChannelCountT::value;
+    }
+
+    /**
+     * @brief Access the samples of a channel without bounds checking.
+     *
+     * @param channel   Rank of the channel in the scan sequence (0-based).
+     *
+     * @returns Raw samples of the channel, oldest first.
+     */
+    [[nodiscard]]
+    std::span<const std::uint16_t, BlockSizeT::value> Channel(std::size_t channel) const noexcept
+    {
+        return std::span<const std::uint16_t, BlockSizeT::value>{
+            m_samples.data() + channel * BlockSizeT::value, BlockSizeT::value
+        };
+    }
+
+protected:
+    /** Index of the first sequence of the block, counted from Start() */
+    std::uint64_t m_first_sequence{0};
+
+private:
+    template <__Internal::__IsUniqueTag, IsAdcScanChannelCount, IsAdcScanBlockSize, typename>
+    friend class __Internal::__AdcDmaBlocks;
+
+    std::array<std::uint16_t, ChannelCountT::value * BlockSizeT::value> m_samples{};
+};
+
+namespace __Internal {
+
+/**
+ * @class __AdcDmaBlocks, Circular ADC DMA buffer de-interleaved into double-buffered blocks.
+ *
+ * The DMA fills a circular buffer of two halves, each holding BlockSizeT
+ * sequences. Every completed half is handed to the half callback, then
+ * de-interleaved into the block not held by the application and published,
+ * and then the block-ready callback is invoked. If the ready block is not
+ * released when the next half completes, that half is dropped and counted
+ * and the block-ready callback is not invoked.
+ *
+ * An ADC or DMA error is counted and the DMA is restarted from the first
+ * half; the partial half is counted as a lost block so block sequence
+ * indices keep growing.
+ *
+ * @tparam UniqueTagT       Unique tag type of the owner.
+ * @tparam ChannelCountT    Number of ranks in the regular sequence.
+ * @tparam BlockSizeT       Sequences per half buffer.
+ * @tparam BlockT           AdcScanBlock or a type derived from it.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <
+    __IsUniqueTag UniqueTagT,
+    IsAdcScanChannelCount ChannelCountT,
+    IsAdcScanBlockSize BlockSizeT,
+    typename BlockT
+>
+class __AdcDmaBlocks {
+    using HalfCompleteCallbackT = __CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_CONVERSION_HALF_CB_ID
+    >;
+    using CompleteCallbackT = __CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_CONVERSION_COMPLETE_CB_ID
+    >;
+    using ErrorCallbackT = __CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_ERROR_CB_ID
+    >;
+public:
+    static constexpr std::size_t half_size{ChannelCountT::value * BlockSizeT::value};
+
+    /**
+     * @brief Construct __AdcDmaBlocks class.
+     *
+     * @param handle    Reference to the ADC handle.
+     */
+    explicit __AdcDmaBlocks(ADC_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_half_complete_callback{handle},
+        m_complete_callback{handle},
+        m_error_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __AdcDmaBlocks(const __AdcDmaBlocks&) = delete;
+    __AdcDmaBlocks& operator=(const __AdcDmaBlocks&) = delete;
+    __AdcDmaBlocks(__AdcDmaBlocks&&) = delete;
+    __AdcDmaBlocks& operator=(__AdcDmaBlocks&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Arm the circular DMA from the first half.
+     *
+     * @param block_ready_callback  Callback function to be called on every published block.
+     * @param half_callback         Callback function to be called on every completed half,
+     *                              before it is de-interleaved (see GetInterleaved()).
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start(CallbackT&& block_ready_callback, CallbackT&& half_callback = nullptr) noexcept
+    {
+        m_block_ready_callback = std::move(block_ready_callback);
+        m_half_callback = std::move(half_callback);
+        m_active_block = 0;
+        m_half_count = 0;
+        m_ready_block.store(no_block, std::memory_order_release);
+        m_completed_half.store(0, std::memory_order_release);
+        m_half_complete_callback.Set([this](){
+            OnTransfer(0);
+        });
+        m_complete_callback.Set([this](){
+            OnTransfer(1);
+        });
+        m_error_callback.Set([this](){
+            OnError();
+        });
+        return StartDma();
+    }
+
+    /**
+     * @brief Stop conversions and the DMA.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_running.store(false, std::memory_order_release);
+        return (HAL_OK == HAL_ADC_Stop_DMA(&m_handle));
+    }
+
+    /**
+     * @returns True while the DMA runs, false after Stop() or a failed restart after an error.
+     */
+    [[nodiscard]]
+    bool IsRunning() const noexcept
+    {
+        return m_running.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns The most recently completed half buffer in conversion order.
+     */
+    [[nodiscard]]
+    std::span<const std::uint16_t, half_size> GetInterleaved() const noexcept
+    {
+        return std::span<const std::uint16_t, half_size>{
+            m_dma_buffer.data() + m_completed_half.load(std::memory_order_acquire) * half_size,
+            half_size
+        };
+    }
+
+    /**
+     * @returns Pointer to the block ready for processing, nullptr if none.
+     */
+    [[nodiscard]]
+    const BlockT* GetReadyBlock() const noexcept
+    {
+        const auto index = m_ready_block.load(std::memory_order_acquire);
+        return (index == no_block) ? nullptr : &m_blocks[index];
+    }
+
+    /**
+     * @brief Hand the ready block back for acquisition.
+     */
+    void ReleaseBlock() noexcept
+    {
+        m_ready_block.store(no_block, std::memory_order_release);
+    }
+
+    /**
+     * @returns Number of blocks dropped because the ready block was not released in time.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedBlockCount() const noexcept
+    {
+        return m_dropped_blocks.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns Number of ADC or DMA errors, each one restarts the DMA.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_error_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t no_block{2};
+
+    ADC_HandleTypeDef& m_handle;
+    HalfCompleteCallbackT m_half_complete_callback;
+    CompleteCallbackT m_complete_callback;
+    ErrorCallbackT m_error_callback;
+    CallbackT m_block_ready_callback{};
+    CallbackT m_half_callback{};
+    DmaBuffer<std::uint16_t, 2 * half_size> m_dma_buffer{};
+    std::array<BlockT, 2> m_blocks{};
+    std::size_t m_active_block{0};
+    std::uint64_t m_half_count{0};
+    std::atomic<std::size_t> m_completed_half{0};
+    std::atomic<std::size_t> m_ready_block{no_block};
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint32_t> m_dropped_blocks{0};
+    std::atomic<std::uint32_t> m_error_count{0};
+
+    /**
+     * @brief Arm the circular DMA from the first half.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartDma() noexcept
+    {
+        __InvalidateDCache(m_dma_buffer.data(), sizeof(m_dma_buffer));
+        const bool started = (HAL_OK == HAL_ADC_Start_DMA(
+            &m_handle,
+            reinterpret_cast<std::uint32_t*>(m_dma_buffer.data()),
+            static_cast<std::uint32_t>(m_dma_buffer.size())
+        ));
+        m_running.store(started, std::memory_order_release);
+        return started;
+    }
+
+    /**
+     * @brief Count an error and restart the DMA, an overrun stops its requests.
+     */
+    void OnError() noexcept
+    {
+        m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+        if (!m_running.load(std::memory_order_acquire)) {
+            return;
+        }
+        HAL_ADC_Stop_DMA(&m_handle);
+        ++m_half_count;
+        StartDma();
+    }
+
+    /**
+     * @brief Publish a completed half buffer.
+     *
+     * @param half      Index of the completed half (0 first, 1 second).
+     *
+     * @note The DMA keeps writing the other half, invalidating a cache line
+     *       shared with it is harmless as the CPU never writes the buffer.
+     */
+    void OnTransfer(std::size_t half) noexcept
+    {
+        const std::uint64_t first_sequence{m_half_count * BlockSizeT::value};
+        ++m_half_count;
+        auto* samples = m_dma_buffer.data() + half * half_size;
+        __InvalidateDCache(samples, half_size * sizeof(std::uint16_t));
+        m_completed_half.store(half, std::memory_order_release);
+        if (m_half_callback) {
+            m_half_callback();
+        }
+        if (m_ready_block.load(std::memory_order_acquire) != no_block) {
+            m_dropped_blocks.store(GetDroppedBlockCount() + 1, std::memory_order_relaxed);
+            return;
+        }
+        auto& block = m_blocks[m_active_block];
+        AdcDeinterleave<ChannelCountT::value, BlockSizeT::value>(
+            std::span<const std::uint16_t, half_size>{samples, half_size}, block.m_samples
+        );
+        block.m_first_sequence = first_sequence;
+        m_ready_block.store(m_active_block, std::memory_order_release);
+        m_active_block ^= 1;
+        if (m_block_ready_callback) {
+            m_block_ready_callback();
+        }
+    }
+};
+
+} /* namespace __Internal */
+
+/**
+ * @class AdcScan, Continuous multi-channel ADC scan into a circular DMA buffer.
+ *
+ * The ADC converts the regular sequence continuously and the DMA fills a
+ * circular buffer of two halves, each holding BlockSizeT sequences. On every
+ * half and full transfer interrupt the completed half is:
+ *  - published as the latest value of each channel (GetLatest()),
+ *  - exposed in conversion order without copying (GetInterleaved()),
+ *  - de-interleaved into a double-buffered block (GetReadyBlock()),
+ * and then the block-ready callback is invoked.
+ *
+ * If the application has not released the ready block when the next half
+ * completes, that half is not de-interleaved and a dropped block is counted.
+ * The interleaved view and the latest values are always updated.
+ *
+ * An ADC or DMA error (e.g., an overrun, which stops the DMA requests) is
+ * counted and the DMA is restarted from the first half, so conversions do
+ * not stall; IsRunning() turns false if that restart fails.
+ *
+ * @tparam UniqueTagT       Unique tag type to differentiate multiple AdcScan instances.
+ *                          UniqueTagT must be STM32_UNIQUE_TAG.
+ * @tparam ChannelCountT    Number of ranks in the regular sequence (e.g., AdcScanChannelCount<4>).
+ * @tparam BlockSizeT       Sequences per half buffer (e.g., AdcScanBlockSize<64>).
+ *
+ * @note AdcScan class is non-copyable and non-movable.
+ * @note The ADC must be configured by CubeMX for scan and continuous conversion
+ *       with DMA continuous requests, the DMA stream in circular mode with
+ *       half-word data width, and the number of conversions equal to ChannelCountT.
+ * @note Requires USE_HAL_ADC_REGISTER_CALLBACKS.
+ * @note The interleaved view is valid until the DMA overwrites that half, i.e.
+ *       for BlockSizeT sequences after the callback.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * ADC_HandleTypeDef hadc1; // Assume 4-rank scan with circular DMA by CubeMX
+ *
+ * STM32::AdcScan<
+ *     STM32_UNIQUE_TAG, STM32::AdcScanChannelCount<4>, STM32::AdcScanBlockSize<64>
+ * > scan{hadc1};
+ *
+ * scan.Start([](){
+ *     // Half buffer completed, called in interrupt context
+ * });
+ *
+ * while (true) {
+ *     auto battery = scan.GetLatest(3);
+ *     if (const auto* block = scan.GetReadyBlock()) {
+ *         for (auto sample : block->Channel(0)) {
+ *             // Process channel 0 samples
+ *         }
+ *         scan.ReleaseBlock();
+ *     }
+ * }
+ * @endcode
+ */
+template <
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsAdcScanChannelCount ChannelCountT,
+    IsAdcScanBlockSize BlockSizeT
+>
+class AdcScan {
+    using DmaBlocksT = __Internal::__AdcDmaBlocks<
+        UniqueTagT, ChannelCountT, BlockSizeT, AdcScanBlock<ChannelCountT, BlockSizeT>
+    >;
+
+    static constexpr std::size_t half_size{DmaBlocksT::half_size};
+public:
+    using BlockT = AdcScanBlock<ChannelCountT, BlockSizeT>;
+
+    /**
+     * @brief Construct AdcScan class.
+     *
+     * @param handle    Reference to the ADC handle.
+     *
+     * @note Conversions are not started until Start() is called.
+     */
+    explicit AdcScan(ADC_HandleTypeDef& handle) noexcept
+      : m_handle{handle}, m_dma_blocks{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    AdcScan(const AdcScan&) = delete;
+    AdcScan& operator=(const AdcScan&) = delete;
+    AdcScan(AdcScan&&) = delete;
+    AdcScan& operator=(AdcScan&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the AdcScan object, stops conversions.
+     */
+    ~AdcScan()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Start continuous conversions into the circular DMA buffer.
+     *
+     * @param block_ready_callback  Callback function to be called on every published block,
+     *                              dropped blocks do not call it.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start(CallbackT&& block_ready_callback = [](){}) noexcept
+    {
+        return m_dma_blocks.Start(std::move(block_ready_callback), [this](){
+            OnHalf();
+        });
+    }
+
+    /**
+     * @brief Stop conversions and the DMA.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        return m_dma_blocks.Stop();
+    }
+
+    /**
+     * @returns True while conversions run, false after Stop() or a failed restart after an error.
+     */
+    [[nodiscard]]
+    bool IsRunning() const noexcept
+    {
+        return m_dma_blocks.IsRunning();
+    }
+
+    /**
+     * @brief Get the most recent sample of a channel without bounds checking.
+     *
+     * Lock-free, can be called from any context.
+     *
+     * @param channel   Rank of the channel in the scan sequence (0-based).
+     *
+     * @returns Raw value of the last sequence of the most recently completed half.
+     */
+    [[nodiscard]]
+    std::uint16_t GetLatest(std::size_t channel) const noexcept
+    {
+        return m_latest[channel].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns The most recently completed half buffer in conversion order.
+     *
+     * @note Valid until the DMA overwrites it, BlockSizeT sequences later.
+     */
+    [[nodiscard]]
+    std::span<const std::uint16_t, half_size> GetInterleaved() const noexcept
+    {
+        return m_dma_blocks.GetInterleaved();
+    }
+
+    /**
+     * @returns Pointer to the de-interleaved block ready for processing, nullptr if none.
+     */
+    [[nodiscard]]
+    const BlockT* GetReadyBlock() const noexcept
+    {
+        return m_dma_blocks.GetReadyBlock();
+    }
+
+    /**
+     * @brief Hand the ready block back for acquisition.
+     */
+    void ReleaseBlock() noexcept
+    {
+        m_dma_blocks.ReleaseBlock();
+    }
+
+    /**
+     * @returns Number of blocks dropped because the ready block was not released in time.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedBlockCount() const noexcept
+    {
+        return m_dma_blocks.GetDroppedBlockCount();
+    }
+
+    /**
+     * @returns Number of ADC or DMA errors (e.g., overruns), each one restarts the DMA.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_dma_blocks.GetErrorCount();
+    }
+
+private:
+    ADC_HandleTypeDef& m_handle;
+    DmaBlocksT m_dma_blocks;
+    std::array<std::atomic<std::uint16_t>, ChannelCountT::value> m_latest{};
+
+    /**
+     * @brief Publish the last sequence of the completed half as the latest values.
+     */
+    void OnHalf() noexcept
+    {
+        const auto interleaved = m_dma_blocks.GetInterleaved();
+        for (std::size_t channel{}; channel < ChannelCountT::value; ++channel) {
+            m_latest[channel].store(
+                interleaved[half_size - ChannelCountT::value + channel],
+                std::memory_order_relaxed
+            );
+        }
+    }
+};
+
+/**
+ * @struct AdcWatchdogThresholds, A utility struct to hold the analog watchdog window.
+ *
+ * @tparam LowV     Lowest output value inside the window, in AdcOutputMax units.
+ * @tparam HighV    Highest output value inside the window, in AdcOutputMax units.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * using CurrentLimit = STM32::AdcWatchdogThresholds<0, 2'500>; // Up to 2500 mA
+ * auto high = CurrentLimit::high; // high is 2500.
+ * @endcode
+ */
+template <std::uint32_t LowV, std::uint32_t HighV>
+struct AdcWatchdogThresholds {
+    static_assert(
+        LowV <= HighV,
+        "Low threshold must not be greater than the high threshold!"
+    );
+    static constexpr std::uint32_t low{LowV};
+    static constexpr std::uint32_t high{HighV};
+};
+
+/**
+ * @brief IsAdcWatchdogThresholds, A concept to check if a type is a AdcWatchdogThresholds.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcWatchdogThresholds<STM32::AdcWatchdogThresholds<10, 90>>);
+ * static_assert(!STM32::IsAdcWatchdogThresholds<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcWatchdogThresholds =
+    std::same_as<std::remove_cv_t<decltype(T::low)>, std::uint32_t> &&
+    std::same_as<std::remove_cv_t<decltype(T::high)>, std::uint32_t> &&
+    (T::low <= T::high);
+
+/**
+ * @class AdcWatchdog, Interrupt-driven threshold detection with the analog watchdog.
+ *
+ * Programs analog watchdog 1 of the ADC to guard one channel and invokes a
+ * callback from the ADC interrupt when a conversion falls outside the window,
+ * so limits are detected within one conversion without polling. The window is
+ * given in the output units of AdcConfigT and converted to raw codes at
+ * compile time with the same rounding as Adc::Get(): an event fires exactly
+ * for the raw values Get() would map below ThresholdsT::low or above
+ * ThresholdsT::high.
+ *
+ * Events are latched: the watchdog interrupt is disabled when it fires, so a
+ * level staying out of the window does not interrupt on every conversion.
+ * Call Rearm() to detect the next violation.
+ *
+ * @tparam UniqueTagT   Unique tag type to differentiate multiple AdcWatchdog instances.
+ *                      UniqueTagT must be STM32_UNIQUE_TAG.
+ * @tparam AdcConfigT   ADC configuration with an AdcOutputMax output range.
+ * @tparam ThresholdsT  Window in output units (e.g., AdcWatchdogThresholds<0, 2'500>).
+ *
+ * @note AdcWatchdog class is non-copyable and non-movable.
+ * @note The watchdog only compares conversions, the ADC must be converting
+ *       the guarded channel (e.g., with AdcContinuous, AdcScan or AdcAcquisition).
+ * @note The ADC global interrupt must be enabled in NVIC.
+ * @note Requires USE_HAL_ADC_REGISTER_CALLBACKS.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * ADC_HandleTypeDef hadc1; // Assume continuous conversion by CubeMX
+ *
+ * // Current sense: 0-3300 mA over the 12-bit range
+ * using CurrentConfig = STM32::AdcConfig<
+ *     STM32::AdcOutputMax<3'300>,
+ *     STM32::AdcResolution::Resolution12Bit,
+ *     STM32::AdcMedianFilterSize<1>,
+ *     STM32::AdcTimeout<10>
+ * >;
+ *
+ * STM32::AdcContinuous<> adc{hadc1};
+ * STM32::AdcWatchdog<
+ *     STM32_UNIQUE_TAG, CurrentConfig, STM32::AdcWatchdogThresholds<0, 2'500>
+ * > overcurrent{hadc1, ADC_CHANNEL_1};
+ *
+ * overcurrent.Start([](){
+ *     // Above 2500 mA, called in interrupt context
+ * });
+ * adc.Start();
+ *
+ * // After the fault is handled
+ * overcurrent.Rearm();
+ * @endcode
+ */
+template <
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsAdcConfig AdcConfigT,
+    IsAdcWatchdogThresholds ThresholdsT
+>
+class AdcWatchdog {
+    using OutOfWindowCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_LEVEL_OUT_OF_WINDOW_1_CB_ID
+    >;
+
+    using OutputRangeT = typename AdcConfigT::OutputRangeT;
+    using ResolutionT = typename AdcConfigT::ResolutionT;
+
+    static_assert(
+        IsAdcOutputMax<OutputRangeT>,
+        "Watchdog thresholds require an AdcOutputMax output range!"
+    );
+
+    static constexpr std::uint32_t resolution{static_cast<std::uint32_t>(ResolutionT::resolution)};
+
+    /**
+     * @returns Output of Adc::Get() for a raw value.
+     */
+    static constexpr std::int64_t ToOutput(std::uint32_t adc_value) noexcept
+    {
+        return __Internal::__RoundToInt64(
+            (adc_value * OutputRangeT::range_size) / ResolutionT::resolution
+        ) + __Internal::__RoundToInt64(OutputRangeT::min_value);
+    }
+
+    /**
+     * @returns Smallest raw value with an output of at least ThresholdsT::low.
+     */
+    static constexpr std::uint32_t LowThreshold() noexcept
+    {
+        std::uint32_t adc_value{0};
+        while (adc_value < resolution && ToOutput(adc_value) < ThresholdsT::low) {
+            ++adc_value;
+        }
+        return adc_value;
+    }
+
+    /**
+     * @returns Largest raw value with an output of at most ThresholdsT::high.
+     */
+    static constexpr std::uint32_t HighThreshold() noexcept
+    {
+        std::uint32_t adc_value{resolution};
+        while (adc_value > 0 && ToOutput(adc_value) > ThresholdsT::high) {
+            --adc_value;
+        }
+        return adc_value;
+    }
+
+    static_assert(
+        ToOutput(0) <= ThresholdsT::high,
+        "High threshold is below the output range!"
+    );
+    static_assert(
+        ThresholdsT::low <= ToOutput(resolution),
+        "Low threshold is above the output range!"
+    );
+public:
+
+    /**
+     * @brief Raw window programmed into the watchdog.
+     * @{
+     */
+    static constexpr std::uint32_t low_threshold{LowThreshold()};
+    static constexpr std::uint32_t high_threshold{HighThreshold()};
+    /** @} */
+
+    /**
+     * @brief Construct AdcWatchdog class.
+     *
+     * @param handle    Reference to the ADC handle.
+     * @param channel   Guarded channel (e.g., ADC_CHANNEL_1).
+     *
+     * @note The watchdog is not enabled until Start() is called.
+     */
+    AdcWatchdog(ADC_HandleTypeDef& handle, std::uint32_t channel) noexcept
+      : m_handle{handle},
+        m_channel{channel},
+        m_watchdog_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    AdcWatchdog(const AdcWatchdog&) = delete;
+    AdcWatchdog& operator=(const AdcWatchdog&) = delete;
+    AdcWatchdog(AdcWatchdog&&) = delete;
+    AdcWatchdog& operator=(AdcWatchdog&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the AdcWatchdog object, disables the watchdog interrupt.
+     */
+    ~AdcWatchdog()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Program the window and enable the watchdog interrupt.
+     *
+     * @param out_of_window_callback    Callback function to be called when a
+     *                                  conversion leaves the window.
+     *
+     * @returns True on success, false otherwise.
+     *
+     * @note Call before starting conversions, some families only accept
+     *       watchdog configuration while the ADC is stopped.
+     */
+    bool Start(CallbackT&& out_of_window_callback) noexcept
+    {
+        m_out_of_window_callback = std::move(out_of_window_callback);
+        m_watchdog_callback.Set([this](){
+            DisableInterrupt();
+            m_event_count.store(GetEventCount() + 1, std::memory_order_relaxed);
+            if (m_out_of_window_callback) {
+                m_out_of_window_callback();
+            }
+        });
+        ADC_AnalogWDGConfTypeDef config{};
+#if defined(ADC_ANALOGWATCHDOG_1)
+        config.WatchdogNumber = ADC_ANALOGWATCHDOG_1;
+#endif /* ADC_ANALOGWATCHDOG_1 */
+        config.WatchdogMode = ADC_ANALOGWATCHDOG_SINGLE_REG;
+        config.Channel = m_channel;
+        config.ITMode = ENABLE;
+        config.HighThreshold = high_threshold;
+        config.LowThreshold = low_threshold;
+        if (HAL_OK != HAL_ADC_AnalogWDGConfig(&m_handle, &config)) {
+            return false;
+        }
+        Rearm();
+        return true;
+    }
+
+    /**
+     * @brief Disable the watchdog interrupt.
+     */
+    void Stop() noexcept
+    {
+        DisableInterrupt();
+    }
+
+    /**
+     * @brief Clear a pending event and enable the watchdog interrupt again.
+     */
+    void Rearm() noexcept
+    {
+        __HAL_ADC_CLEAR_FLAG(&m_handle, flag);
+        __HAL_ADC_ENABLE_IT(&m_handle, interrupt);
+    }
+
+    /**
+     * @returns Number of out of window events since construction.
+     */
+    [[nodiscard]]
+    std::uint32_t GetEventCount() const noexcept
+    {
+        return m_event_count.load(std::memory_order_relaxed);
+    }
+
+private:
+#if defined(ADC_IT_AWD1)
+    static constexpr std::uint32_t interrupt{ADC_IT_AWD1};
+    static constexpr std::uint32_t flag{ADC_FLAG_AWD1};
+#else /* ADC_IT_AWD1 */
+    static constexpr std::uint32_t interrupt{ADC_IT_AWD};
+    static constexpr std::uint32_t flag{ADC_FLAG_AWD};
+#endif /* ADC_IT_AWD1 */
+
+    ADC_HandleTypeDef& m_handle;
+    std::uint32_t m_channel;
+    OutOfWindowCallbackT m_watchdog_callback;
+    CallbackT m_out_of_window_callback{};
+    std::atomic<std::uint32_t> m_event_count{0};
+
+    /**
+     * @brief Disable the watchdog interrupt, the watchdog keeps comparing.
+     */
+    void DisableInterrupt() noexcept
+    {
+        __HAL_ADC_DISABLE_IT(&m_handle, interrupt);
     }
 };
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
 
 } /* namespace STM32 */
 
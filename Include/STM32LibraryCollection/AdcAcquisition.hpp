@@ -0,0 +1,454 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_ADC_ACQUISITION_HPP
+#define STM32_ADC_ACQUISITION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Adc.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) /* module check */
+#error "HAL TIM module is not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct AdcSampleRate, A utility struct to hold the sampling rate of a timer-triggered ADC.
+ *
+ * @tparam RateV    Conversions (scan sequences) per second in Hz.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcAcquisition.hpp>
+ *
+ * using MyRate = STM32::AdcSampleRate<48'000>;
+ * auto rate = MyRate::value; // rate is 48000.
+ * @endcode
+ */
+template <std::uint32_t RateV>
+struct AdcSampleRate : __Internal::__Constant<std::uint32_t, RateV> {
+    static_assert(
+        RateV > 0,
+        "Sample rate must be greater than zero!"
+    );
+};
+
+/**
+ * @brief IsAdcSampleRate, A concept to check if a type is a AdcSampleRate.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcAcquisition.hpp>
+ *
+ * static_assert(STM32::IsAdcSampleRate<STM32::AdcSampleRate<48'000>>);
+ * static_assert(!STM32::IsAdcSampleRate<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcSampleRate =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    T::value > 0;
+
+/**
+ * @struct AdcTriggerClock, A utility struct to hold the input clock of the trigger timer.
+ *
+ * @tparam ClockV   Timer kernel clock in Hz before the prescaler (e.g., 2 x APB1 when
+ *                  the APB1 prescaler is not 1).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcAcquisition.hpp>
+ *
+ * using MyClock = STM32::AdcTriggerClock<84'000'000>;
+ * auto clock = MyClock::value; // clock is 84000000.
+ * @endcode
+ */
+template <std::uint32_t ClockV>
+struct AdcTriggerClock : __Internal::__Constant<std::uint32_t, ClockV> {
+    static_assert(
+        ClockV > 0,
+        "Trigger clock must be greater than zero!"
+    );
+};
+
+/**
+ * @brief IsAdcTriggerClock, A concept to check if a type is a AdcTriggerClock.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcAcquisition.hpp>
+ *
+ * static_assert(STM32::IsAdcTriggerClock<STM32::AdcTriggerClock<84'000'000>>);
+ * static_assert(!STM32::IsAdcTriggerClock<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcTriggerClock =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    T::value > 0;
+
+namespace __Internal {
+
+/**
+ * @struct __TimerDivider, Prescaler and period dividing a timer clock to an exact rate.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+struct __TimerDivider {
+    std::uint32_t prescaler{};  /**< Clock division, PSC + 1 (0 if the rate is not reachable) */
+    std::uint32_t period{};     /**< Counts per update, ARR + 1 */
+
+    /**
+     * @brief Split clock / rate into 16-bit prescaler and period factors.
+     *
+     * @param clock     Timer input clock in Hz.
+     * @param rate      Update rate in Hz.
+     *
+     * @returns Divider with the smallest prescaler, so the period has the
+     *          finest resolution, or a zero divider if clock is not an exact
+     *          multiple of rate or the ratio does not fit the 16-bit registers.
+     */
+    [[nodiscard]]
+    static constexpr __TimerDivider Make(std::uint32_t clock, std::uint32_t rate) noexcept
+    {
+        constexpr std::uint32_t register_max{65536};
+        if (rate == 0 || clock % rate != 0) {
+            return {};
+        }
+        const std::uint32_t ratio{clock / rate};
+        for (std::uint32_t prescaler{1}; prescaler <= register_max; ++prescaler) {
+            if (ratio % prescaler == 0 && ratio / prescaler <= register_max) {
+                return {prescaler, ratio / prescaler};
+            }
+            if (ratio / prescaler < prescaler) {
+                break;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @returns True if the divider reaches the requested rate.
+     */
+    [[nodiscard]]
+    constexpr bool IsValid() const noexcept
+    {
+        return prescaler != 0 && period > 1;
+    }
+};
+
+} /* namespace __Internal */
+
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+/**
+ * @class AdcAcquisitionBlock, A block of timer-triggered scan sequences grouped by channel.
+ *
+ * @tparam ChannelCountT    Number of channels per sequence.
+ * @tparam BlockSizeT       Number of sequences in the block.
+ */
+template <IsAdcScanChannelCount ChannelCountT, IsAdcScanBlockSize BlockSizeT>
+class AdcAcquisitionBlock : public AdcScanBlock<ChannelCountT, BlockSizeT> {
+public:
+
+    /**
+     * @returns Index of the first sample of the block, counted in sample
+     *          periods from the first trigger after Start().
+     *
+     * @note Sample i of the block was triggered at (Timestamp() + i) / sample rate
+     *       seconds, with the accuracy of the timer clock.
+     */
+    [[nodiscard]]
+    std::uint64_t Timestamp() const noexcept
+    {
+        return this->m_first_sequence;
+    }
+};
+
+/**
+ * @class AdcAcquisition, Timer-triggered ADC sampling into DMA blocks at an exact rate.
+ *
+ * The trigger timer is programmed to overflow at exactly SampleRateT, with the
+ * prescaler and period computed and validated at compile time from
+ * TriggerClockT, and its update event is routed to TRGO. The ADC is switched
+ * to single conversions started by that TRGO, so every update converts one
+ * scan sequence regardless of what the CPU is doing. The DMA fills a circular
+ * buffer of two halves of BlockSizeT sequences each, and every completed half
+ * is de-interleaved into a double-buffered block stamped with the index of
+ * its first sample.
+ *
+ * If the application has not released the ready block when the next half
+ * completes, that half is dropped and counted. Sample indices keep counting,
+ * so a gap is visible as a Timestamp() jump of more than BlockSizeT.
+ *
+ * An ADC or DMA error (e.g., an overrun, which stops the DMA requests) is
+ * counted and the DMA is restarted from the first half while the timer keeps
+ * triggering, so sampling does not stall; IsRunning() turns false if that
+ * restart fails. The partial half is lost and the next Timestamp() skips one
+ * block, the samples lost in between are not counted exactly.
+ *
+ * @tparam UniqueTagT       Unique tag type to differentiate multiple AdcAcquisition instances.
+ *                          UniqueTagT must be STM32_UNIQUE_TAG.
+ * @tparam TriggerClockT    Input clock of the trigger timer (e.g., AdcTriggerClock<84'000'000>).
+ * @tparam SampleRateT      Sequences per second (e.g., AdcSampleRate<48'000>), must
+ *                          divide TriggerClockT into 16-bit prescaler and period factors.
+ * @tparam ChannelCountT    Number of ranks in the regular sequence (default is 1).
+ * @tparam BlockSizeT       Sequences per block (default is 256).
+ *
+ * @note AdcAcquisition class is non-copyable and non-movable.
+ * @note The ADC must be configured by CubeMX with DMA continuous requests, the
+ *       DMA stream in circular mode with half-word data width, and the number
+ *       of conversions equal to ChannelCountT. Start() selects the external
+ *       trigger and disables continuous conversion with HAL_ADC_Init().
+ * @note The timer must be configured by CubeMX as an up-counting time base,
+ *       Start() overwrites its prescaler, period and master mode.
+ * @note The sequence conversion time must be shorter than the sample period,
+ *       otherwise triggers are lost and the rate is not exact.
+ * @note Requires USE_HAL_ADC_REGISTER_CALLBACKS.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcAcquisition.hpp>
+ *
+ * ADC_HandleTypeDef hadc1; // Assume 1-rank regular sequence with circular DMA by CubeMX
+ * TIM_HandleTypeDef htim3; // Assume an 84 MHz time base by CubeMX
+ *
+ * STM32::AdcAcquisition<
+ *     STM32_UNIQUE_TAG, STM32::AdcTriggerClock<84'000'000>, STM32::AdcSampleRate<48'000>
+ * > acquisition{hadc1, htim3, ADC_EXTERNALTRIGCONV_T3_TRGO};
+ *
+ * acquisition.Start();
+ *
+ * while (true) {
+ *     if (const auto* block = acquisition.GetReadyBlock()) {
+ *         auto first_sample = block->Timestamp(); // Exactly 256 more than the previous block
+ *         for (auto sample : block->Channel(0)) {
+ *             // Process samples spaced exactly 1/48000 s apart
+ *         }
+ *         acquisition.ReleaseBlock();
+ *     }
+ * }
+ * @endcode
+ */
+template <
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsAdcTriggerClock TriggerClockT,
+    IsAdcSampleRate SampleRateT,
+    IsAdcScanChannelCount ChannelCountT = AdcScanChannelCount<1>,
+    IsAdcScanBlockSize BlockSizeT = AdcScanBlockSize<256>
+>
+class AdcAcquisition {
+    using DmaBlocksT = __Internal::__AdcDmaBlocks<
+        UniqueTagT, ChannelCountT, BlockSizeT, AdcAcquisitionBlock<ChannelCountT, BlockSizeT>
+    >;
+
+    static constexpr auto divider = __Internal::__TimerDivider::Make(
+        TriggerClockT::value, SampleRateT::value
+    );
+    static_assert(
+        TriggerClockT::value % SampleRateT::value == 0,
+        "Sample rate must divide the trigger clock exactly!"
+    );
+    static_assert(
+        divider.IsValid(),
+        "Sample rate is not reachable with 16-bit prescaler and period!"
+    );
+public:
+    using BlockT = AdcAcquisitionBlock<ChannelCountT, BlockSizeT>;
+
+    /**
+     * @brief Construct AdcAcquisition class.
+     *
+     * @param adc_handle        Reference to the ADC handle.
+     * @param timer_handle      Reference to the TIM handle of the trigger timer.
+     * @param external_trigger  ADC external trigger selecting the timer TRGO
+     *                          (e.g., ADC_EXTERNALTRIGCONV_T3_TRGO).
+     *
+     * @note Sampling is not started until Start() is called.
+     */
+    AdcAcquisition(
+        ADC_HandleTypeDef& adc_handle,
+        TIM_HandleTypeDef& timer_handle,
+        std::uint32_t external_trigger
+    ) noexcept
+      : m_handle{adc_handle},
+        m_timer_handle{timer_handle},
+        m_external_trigger{external_trigger},
+        m_dma_blocks{adc_handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    AdcAcquisition(const AdcAcquisition&) = delete;
+    AdcAcquisition& operator=(const AdcAcquisition&) = delete;
+    AdcAcquisition(AdcAcquisition&&) = delete;
+    AdcAcquisition& operator=(AdcAcquisition&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the AdcAcquisition object, stops sampling.
+     */
+    ~AdcAcquisition()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @returns Sampling rate in Hz.
+     */
+    [[nodiscard]]
+    static constexpr std::uint32_t GetSampleRate() noexcept
+    {
+        return SampleRateT::value;
+    }
+
+    /**
+     * @brief Configure the trigger, arm the DMA and start the timer.
+     *
+     * @param block_ready_callback  Callback function to be called on every published block,
+     *                              dropped blocks do not call it.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start(CallbackT&& block_ready_callback = [](){}) noexcept
+    {
+        if (!ConfigureTimer() || !ConfigureAdc()) {
+            return false;
+        }
+        if (!m_dma_blocks.Start(std::move(block_ready_callback))) {
+            return false;
+        }
+        if (HAL_OK != HAL_TIM_Base_Start(&m_timer_handle)) {
+            m_dma_blocks.Stop();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Stop the trigger timer, the conversions and the DMA.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        const bool timer_stopped = (HAL_OK == HAL_TIM_Base_Stop(&m_timer_handle));
+        return m_dma_blocks.Stop() && timer_stopped;
+    }
+
+    /**
+     * @returns True while sampling runs, false after Stop() or a failed restart after an error.
+     */
+    [[nodiscard]]
+    bool IsRunning() const noexcept
+    {
+        return m_dma_blocks.IsRunning();
+    }
+
+    /**
+     * @returns Pointer to the block ready for processing, nullptr if none.
+     */
+    [[nodiscard]]
+    const BlockT* GetReadyBlock() const noexcept
+    {
+        return m_dma_blocks.GetReadyBlock();
+    }
+
+    /**
+     * @brief Hand the ready block back for acquisition.
+     */
+    void ReleaseBlock() noexcept
+    {
+        m_dma_blocks.ReleaseBlock();
+    }
+
+    /**
+     * @returns Number of blocks dropped because the ready block was not released in time.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedBlockCount() const noexcept
+    {
+        return m_dma_blocks.GetDroppedBlockCount();
+    }
+
+    /**
+     * @returns Number of ADC or DMA errors (e.g., overruns), each one restarts the DMA.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_dma_blocks.GetErrorCount();
+    }
+
+private:
+    ADC_HandleTypeDef& m_handle;
+    TIM_HandleTypeDef& m_timer_handle;
+    std::uint32_t m_external_trigger;
+    DmaBlocksT m_dma_blocks;
+
+    /**
+     * @brief Program the sample rate and route the update event to TRGO.
+     *
+     * @returns True on success, false otherwise.
+     *
+     * @note The update generation loads the prescaler before the ADC is
+     *       armed, so it does not trigger a conversion.
+     */
+    bool ConfigureTimer() noexcept
+    {
+        m_timer_handle.Init.Prescaler = divider.prescaler - 1;
+        m_timer_handle.Init.Period = divider.period - 1;
+        __HAL_TIM_SET_PRESCALER(&m_timer_handle, divider.prescaler - 1);
+        __HAL_TIM_SET_AUTORELOAD(&m_timer_handle, divider.period - 1);
+        __HAL_TIM_SET_COUNTER(&m_timer_handle, 0);
+        TIM_MasterConfigTypeDef master_config{};
+        master_config.MasterOutputTrigger = TIM_TRGO_UPDATE;
+        master_config.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+        if (HAL_OK != HAL_TIMEx_MasterConfigSynchronization(&m_timer_handle, &master_config)) {
+            return false;
+        }
+        return (HAL_OK == HAL_TIM_GenerateEvent(&m_timer_handle, TIM_EVENTSOURCE_UPDATE));
+    }
+
+    /**
+     * @brief Select the timer TRGO as the external trigger and re-initialize the ADC.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool ConfigureAdc() noexcept
+    {
+        m_handle.Init.ContinuousConvMode = DISABLE;
+        m_handle.Init.ExternalTrigConv = m_external_trigger;
+#if defined(ADC_EXTERNALTRIGCONVEDGE_RISING)
+        m_handle.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+#endif /* ADC_EXTERNALTRIGCONVEDGE_RISING */
+        return (HAL_OK == HAL_ADC_Init(&m_handle));
+    }
+};
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+
+} /* namespace STM32 */
+
+#endif /* STM32_ADC_ACQUISITION_HPP */
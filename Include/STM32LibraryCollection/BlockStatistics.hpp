@@ -0,0 +1,256 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_BLOCK_STATISTICS_HPP
+#define STM32_BLOCK_STATISTICS_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+
+#include "__Internal/__Constant.hpp"
+#include "__Internal/__Math.hpp"
+#include "__Internal/__Simd.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct BlockStatisticsSampleBits, A utility struct to hold the number of significant bits per sample.
+ *
+ * @tparam BitsV    Significant bits of the samples (1-16), e.g., 12 for a 12-bit ADC.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/BlockStatistics.hpp>
+ *
+ * using Adc12Bit = STM32::BlockStatisticsSampleBits<12>;
+ * auto bits = Adc12Bit::value; // bits is 12.
+ * @endcode
+ */
+template <std::uint32_t BitsV>
+struct BlockStatisticsSampleBits : __Internal::__Constant<std::uint32_t, BitsV> {
+    static_assert(
+        1 <= BitsV && BitsV <= 16,
+        "Sample bits must be between 1 and 16!"
+    );
+};
+
+/**
+ * @brief IsBlockStatisticsSampleBits, A concept to check if a type is a BlockStatisticsSampleBits.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/BlockStatistics.hpp>
+ *
+ * static_assert(STM32::IsBlockStatisticsSampleBits<STM32::BlockStatisticsSampleBits<12>>);
+ * static_assert(!STM32::IsBlockStatisticsSampleBits<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsBlockStatisticsSampleBits =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    1 <= T::value && T::value <= 16;
+
+/**
+ * @class BlockStatistics, Minimum, maximum, mean and RMS of blocks of unsigned samples.
+ *
+ * Accumulates exact integer sums over any number of blocks (e.g., DMA
+ * blocks of AdcScan or AdcAcquisition). On cores with the DSP extension
+ * (STM32_SIMD32, e.g., Cortex-M4, M7) samples of up to 15 bits are processed
+ * two at a time: one SMLAD adds both samples to the sum, one SMLALD adds both
+ * squares to the sum of squares, and USUB16 with SEL updates the packed
+ * minimum and maximum. Elsewhere (Cortex-M0, host) and for 16-bit samples a
+ * scalar loop is used. Both paths compute the same integers, so the results
+ * are identical.
+ *
+ * @tparam SampleBitsT  Significant bits of the samples (default is 12).
+ *
+ * @note Samples must not exceed SampleBitsT bits.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/BlockStatistics.hpp>
+ *
+ * STM32::BlockStatistics<> stats{};
+ *
+ * if (const auto* block = scan.GetReadyBlock()) {
+ *     stats.Reset();
+ *     stats.Update(block->Channel(0));
+ *     scan.ReleaseBlock();
+ *     auto peak = stats.GetMax();
+ *     auto rms = stats.GetRms();
+ * }
+ * @endcode
+ */
+template <IsBlockStatisticsSampleBits SampleBitsT = BlockStatisticsSampleBits<12>>
+class BlockStatistics {
+public:
+
+    /**
+     * @brief Add a block of samples.
+     *
+     * @param samples   Samples, any alignment.
+     */
+    void Update(std::span<const std::uint16_t> samples) noexcept
+    {
+        const std::uint16_t* data{samples.data()};
+        std::size_t size{samples.size()};
+        m_count += size;
+#if STM32_SIMD32
+        if constexpr (SampleBitsT::value <= 15) {
+            while (size >= 2) {
+                const std::size_t chunk{std::min(size & ~std::size_t{1}, simd_chunk_size)};
+                UpdatePairs(data, chunk);
+                data += chunk;
+                size -= chunk;
+            }
+        }
+#endif /* STM32_SIMD32 */
+        UpdateScalar(data, size);
+    }
+
+    /**
+     * @brief Clear the accumulated statistics.
+     */
+    void Reset() noexcept
+    {
+        *this = BlockStatistics{};
+    }
+
+    /**
+     * @returns Number of samples.
+     */
+    [[nodiscard]]
+    std::uint64_t GetCount() const noexcept
+    {
+        return m_count;
+    }
+
+    /**
+     * @returns Smallest sample, 0 before the first sample.
+     */
+    [[nodiscard]]
+    std::uint16_t GetMin() const noexcept
+    {
+        return (m_count == 0) ? 0 : m_min;
+    }
+
+    /**
+     * @returns Largest sample.
+     */
+    [[nodiscard]]
+    std::uint16_t GetMax() const noexcept
+    {
+        return m_max;
+    }
+
+    /**
+     * @returns Sum of the samples.
+     */
+    [[nodiscard]]
+    std::uint64_t GetSum() const noexcept
+    {
+        return m_sum;
+    }
+
+    /**
+     * @returns Sum of the squared samples.
+     */
+    [[nodiscard]]
+    std::uint64_t GetSumOfSquares() const noexcept
+    {
+        return m_sum_of_squares;
+    }
+
+    /**
+     * @returns Mean rounded to nearest, 0 before the first sample.
+     */
+    [[nodiscard]]
+    std::uint32_t GetMean() const noexcept
+    {
+        if (m_count == 0) {
+            return 0;
+        }
+        return static_cast<std::uint32_t>((m_sum + m_count / 2) / m_count);
+    }
+
+    /**
+     * @returns Root mean square rounded down, 0 before the first sample.
+     */
+    [[nodiscard]]
+    std::uint32_t GetRms() const noexcept
+    {
+        if (m_count == 0) {
+            return 0;
+        }
+        return __Internal::__Isqrt(m_sum_of_squares / m_count);
+    }
+
+private:
+    /**
+     * @brief Samples per SIMD pass, keeps the 32-bit signed SMLAD sum of 15-bit samples from overflowing.
+     */
+    static constexpr std::size_t simd_chunk_size{32'768};
+
+    std::uint64_t m_count{0};
+    std::uint64_t m_sum{0};
+    std::uint64_t m_sum_of_squares{0};
+    std::uint16_t m_min{std::numeric_limits<std::uint16_t>::max()};
+    std::uint16_t m_max{0};
+
+    /**
+     * @brief Accumulate samples one at a time.
+     */
+    void UpdateScalar(const std::uint16_t* data, std::size_t size) noexcept
+    {
+        for (std::size_t i{}; i < size; ++i) {
+            const std::uint32_t sample{data[i]};
+            m_min = std::min(m_min, data[i]);
+            m_max = std::max(m_max, data[i]);
+            m_sum += sample;
+            m_sum_of_squares += sample * sample;
+        }
+    }
+
+#if STM32_SIMD32
+    /**
+     * @brief Accumulate an even number of samples, two per instruction.
+     *
+     * @note Samples are read as packed halfword pairs with unaligned word
+     *       loads, which Cortex-M3 and later cores support.
+     */
+    void UpdatePairs(const std::uint16_t* data, std::size_t size) noexcept
+    {
+        std::uint32_t minimum{(std::uint32_t{m_min} << 16) | m_min};
+        std::uint32_t maximum{(std::uint32_t{m_max} << 16) | m_max};
+        std::int32_t sum{};
+        std::int64_t sum_of_squares{};
+        for (std::size_t i{}; i < size; i += 2) {
+            std::uint32_t pair;
+            std::memcpy(&pair, data + i, sizeof(pair));
+            const auto signed_pair = static_cast<std::int32_t>(pair);
+            sum = __smlad(signed_pair, 0x0001'0001, sum);
+            sum_of_squares = __smlald(signed_pair, signed_pair, sum_of_squares);
+            static_cast<void>(__usub16(pair, maximum));
+            maximum = __sel(pair, maximum);
+            static_cast<void>(__usub16(pair, minimum));
+            minimum = __sel(minimum, pair);
+        }
+        m_sum += static_cast<std::uint32_t>(sum);
+        m_sum_of_squares += static_cast<std::uint64_t>(sum_of_squares);
+        m_min = static_cast<std::uint16_t>(std::min(minimum & 0xFFFF, minimum >> 16));
+        m_max = static_cast<std::uint16_t>(std::max(maximum & 0xFFFF, maximum >> 16));
+    }
+#endif /* STM32_SIMD32 */
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_BLOCK_STATISTICS_HPP */
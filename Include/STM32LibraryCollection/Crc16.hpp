@@ -11,6 +11,8 @@
 #include <ranges>
 #include <span>
 
+#include "__Internal/__Reflect.hpp"
+
 namespace STM32 {
 
 /**
@@ -116,29 +118,6 @@ struct Crc16ReflectOutput {
 
 namespace __Internal {
 
-/**
- * @brief Reflect (bit-reverse) an 8-bit value.
- */
-[[nodiscard]]
-constexpr std::uint8_t __Reflect8(std::uint8_t value) noexcept
-{
-    value = static_cast<std::uint8_t>(((value & 0x55) << 1) | ((value & 0xAA) >> 1));
-    value = static_cast<std::uint8_t>(((value & 0x33) << 2) | ((value & 0xCC) >> 2));
-    return static_cast<std::uint8_t>((value << 4) | (value >> 4));
-}
-
-/**
- * @brief Reflect (bit-reverse) a 16-bit value.
- */
-[[nodiscard]]
-constexpr std::uint16_t __Reflect16(std::uint16_t value) noexcept
-{
-    value = static_cast<std::uint16_t>(((value & 0x5555) << 1) | ((value & 0xAAAA) >> 1));
-    value = static_cast<std::uint16_t>(((value & 0x3333) << 2) | ((value & 0xCCCC) >> 2));
-    value = static_cast<std::uint16_t>(((value & 0x0F0F) << 4) | ((value & 0xF0F0) >> 4));
-    return static_cast<std::uint16_t>((value << 8) | (value >> 8));
-}
-
 /**
  * @brief Generate CRC-16 lookup table at compile time.
  * 
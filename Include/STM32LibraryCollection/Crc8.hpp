@@ -0,0 +1,437 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CRC8_HPP
+#define STM32_CRC8_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+
+#include "__Internal/__Reflect.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct Crc8Polynomial, A compile-time CRC-8 polynomial value.
+ *
+ * @tparam PolynomialV  The polynomial value used for CRC calculation.
+ *
+ * @note Common polynomials:
+ *       - 0x07: CRC-8 (SMBus PEC, ATM HEC)
+ *       - 0x31: CRC-8/MAXIM (1-Wire), Sensirion sensors
+ *       - 0x1D: CRC-8/SAE-J1850
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using SmbusPoly = STM32::Crc8Polynomial<0x07>;
+ * using MaximPoly = STM32::Crc8Polynomial<0x31>;
+ * @endcode
+ */
+template <std::uint8_t PolynomialV>
+struct Crc8Polynomial {
+    static constexpr std::uint8_t value = PolynomialV;
+};
+
+/**
+ * @struct Crc8InitialValue, A compile-time CRC-8 initial value.
+ *
+ * @tparam InitialValueV    The initial CRC value before processing data.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using Init00 = STM32::Crc8InitialValue<0x00>;
+ * using InitFF = STM32::Crc8InitialValue<0xFF>;
+ * @endcode
+ */
+template <std::uint8_t InitialValueV>
+struct Crc8InitialValue {
+    static constexpr std::uint8_t value = InitialValueV;
+};
+
+/**
+ * @struct Crc8FinalXor, A compile-time CRC-8 final XOR value.
+ *
+ * @tparam FinalXorV    The value to XOR with the final CRC result.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using NoFinalXor = STM32::Crc8FinalXor<0x00>;
+ * using XorFF = STM32::Crc8FinalXor<0xFF>;
+ * @endcode
+ */
+template <std::uint8_t FinalXorV>
+struct Crc8FinalXor {
+    static constexpr std::uint8_t value = FinalXorV;
+};
+
+/**
+ * @struct Crc8ReflectInput, A compile-time flag for input byte reflection.
+ *
+ * @tparam ReflectV     Whether to bit-reverse each input byte before processing.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using NoReflect = STM32::Crc8ReflectInput<false>;
+ * using Reflect = STM32::Crc8ReflectInput<true>;
+ * @endcode
+ */
+template <bool ReflectV>
+struct Crc8ReflectInput {
+    static constexpr bool value = ReflectV;
+};
+
+/**
+ * @struct Crc8ReflectOutput, A compile-time flag for output CRC reflection.
+ *
+ * @tparam ReflectV     Whether to bit-reverse the final CRC result.
+ *
+ * @note Usually matches Crc8ReflectInput setting.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using NoReflect = STM32::Crc8ReflectOutput<false>;
+ * using Reflect = STM32::Crc8ReflectOutput<true>;
+ * @endcode
+ */
+template <bool ReflectV>
+struct Crc8ReflectOutput {
+    static constexpr bool value = ReflectV;
+};
+
+namespace __Internal {
+
+/**
+ * @brief Generate CRC-8 lookup table at compile time.
+ *
+ * @tparam PolynomialV      The CRC polynomial.
+ * @tparam ReflectInputV    Whether input reflection is enabled.
+ */
+template <std::uint8_t PolynomialV, bool ReflectInputV>
+[[nodiscard]]
+consteval std::array<std::uint8_t, 256> __GenerateCrc8Table() noexcept
+{
+    std::array<std::uint8_t, 256> table{};
+
+    for (std::size_t i = 0; i < 256; ++i) {
+        auto crc = static_cast<std::uint8_t>(i);
+
+        if constexpr (ReflectInputV) {
+            for (int j = 0; j < 8; ++j) {
+                if (crc & 0x01) {
+                    crc = static_cast<std::uint8_t>((crc >> 1) ^ __Reflect8(PolynomialV));
+                } else {
+                    crc >>= 1;
+                }
+            }
+        } else {
+            for (int j = 0; j < 8; ++j) {
+                if (crc & 0x80) {
+                    crc = static_cast<std::uint8_t>((crc << 1) ^ PolynomialV);
+                } else {
+                    crc = static_cast<std::uint8_t>(crc << 1);
+                }
+            }
+        }
+
+        table[i] = crc;
+    }
+
+    return table;
+}
+
+} /* namespace __Internal */
+
+/**
+ * @concept IsCrc8Polynomial
+ * @brief Checks if a type is a valid CRC-8 polynomial.
+ */
+template <typename T>
+concept IsCrc8Polynomial = requires {
+    { T::value } -> std::convertible_to<std::uint8_t>;
+};
+
+/**
+ * @concept IsCrc8InitialValue
+ * @brief Checks if a type is a valid CRC-8 initial value.
+ */
+template <typename T>
+concept IsCrc8InitialValue = requires {
+    { T::value } -> std::convertible_to<std::uint8_t>;
+};
+
+/**
+ * @concept IsCrc8FinalXor
+ * @brief Checks if a type is a valid CRC-8 final XOR value.
+ */
+template <typename T>
+concept IsCrc8FinalXor = requires {
+    { T::value } -> std::convertible_to<std::uint8_t>;
+};
+
+/**
+ * @concept IsCrc8ReflectInput
+ * @brief Checks if a type is a valid CRC-8 input reflection flag.
+ */
+template <typename T>
+concept IsCrc8ReflectInput = requires {
+    { T::value } -> std::convertible_to<bool>;
+};
+
+/**
+ * @concept IsCrc8ReflectOutput
+ * @brief Checks if a type is a valid CRC-8 output reflection flag.
+ */
+template <typename T>
+concept IsCrc8ReflectOutput = requires {
+    { T::value } -> std::convertible_to<bool>;
+};
+
+/**
+ * @concept IsCrc8Data
+ * @brief Checks if a type is a valid data source for CRC calculation.
+ */
+template <typename T>
+concept IsCrc8Data =
+    std::ranges::contiguous_range<T> &&
+    std::ranges::sized_range<T> &&
+    std::same_as<std::ranges::range_value_t<T>, std::uint8_t>;
+
+/**
+ * @class Crc8, A compile-time configurable CRC-8 calculator.
+ *
+ * All CRC parameters are template arguments for self-documentation and
+ * compile-time validation. Uses a lookup table generated at compile time,
+ * so each byte costs one table access instead of an eight-step bit loop.
+ *
+ * @tparam PolynomialT      CRC polynomial (e.g., Crc8Polynomial<0x07>).
+ * @tparam InitialValueT    Initial CRC value (e.g., Crc8InitialValue<0x00>).
+ * @tparam FinalXorT        Final XOR value (e.g., Crc8FinalXor<0x00>).
+ * @tparam ReflectInputT    Input reflection flag (e.g., Crc8ReflectInput<false>).
+ * @tparam ReflectOutputT   Output reflection flag (e.g., Crc8ReflectOutput<false>).
+ *
+ * @note The lookup table is generated at compile time (consteval).
+ * @note All Calculate methods are constexpr and can be evaluated at compile time.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc8.hpp>
+ *
+ * // SMBus Packet Error Code of a Write Byte to device 0x0B, command 0x00
+ * constexpr std::array<std::uint8_t, 3> frame{0x16, 0x00, 0x5A};
+ * constexpr auto pec = STM32::Crc8Smbus::Calculate(frame);
+ *
+ * // Streaming over several buffers
+ * auto crc = STM32::Crc8Smbus::Init();
+ * crc = STM32::Crc8Smbus::Update(crc, frame);
+ * auto result = STM32::Crc8Smbus::Finalize(crc);
+ * @endcode
+ */
+template <
+    IsCrc8Polynomial PolynomialT,
+    IsCrc8InitialValue InitialValueT,
+    IsCrc8FinalXor FinalXorT,
+    IsCrc8ReflectInput ReflectInputT,
+    IsCrc8ReflectOutput ReflectOutputT
+>
+class Crc8 {
+public:
+    /** @brief The CRC polynomial used. */
+    static constexpr std::uint8_t polynomial = PolynomialT::value;
+
+    /** @brief The initial CRC value. */
+    static constexpr std::uint8_t initial_value = InitialValueT::value;
+
+    /** @brief The final XOR value. */
+    static constexpr std::uint8_t final_xor = FinalXorT::value;
+
+    /** @brief Whether input bytes are reflected. */
+    static constexpr bool reflect_input = ReflectInputT::value;
+
+    /** @brief Whether output CRC is reflected. */
+    static constexpr bool reflect_output = ReflectOutputT::value;
+
+    /**
+     * @brief Calculate CRC-8 of a contiguous byte range.
+     *
+     * @param data  A contiguous range of bytes (std::array, std::vector, std::span, etc.).
+     *
+     * @returns The calculated CRC-8 value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Calculate(IsCrc8Data auto const& data) noexcept
+    {
+        return Calculate(std::ranges::data(data), std::ranges::size(data));
+    }
+
+    /**
+     * @brief Calculate CRC-8 of a byte array.
+     *
+     * @param data      Pointer to the data bytes.
+     * @param length    Number of bytes to process.
+     *
+     * @returns The calculated CRC-8 value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Calculate(
+        const std::uint8_t* data,
+        std::size_t length
+    ) noexcept
+    {
+        std::uint8_t crc = initial_value;
+        if constexpr (reflect_input) {
+            crc = __Internal::__Reflect8(crc);
+        }
+        for (std::size_t i = 0; i < length; ++i) {
+            crc = s_table[static_cast<std::uint8_t>(crc ^ data[i])];
+        }
+        return Finalize(crc);
+    }
+
+    /**
+     * @brief Update an existing CRC with additional data (for streaming).
+     *
+     * @param crc       The current CRC value to update.
+     * @param data      A contiguous range of bytes to process.
+     *
+     * @returns The updated CRC-8 value.
+     *
+     * @note To finalize, call Finalize() with the updated CRC value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Update(
+        std::uint8_t crc,
+        IsCrc8Data auto const& data
+    ) noexcept
+    {
+        for (const auto byte : data) {
+            crc = s_table[static_cast<std::uint8_t>(crc ^ byte)];
+        }
+        return crc;
+    }
+
+    /**
+     * @brief Update an existing CRC with a single byte (for streaming).
+     *
+     * @param crc       The current CRC value to update.
+     * @param byte      The byte to process.
+     *
+     * @returns The updated CRC-8 value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Update(
+        std::uint8_t crc,
+        std::uint8_t byte
+    ) noexcept
+    {
+        return s_table[static_cast<std::uint8_t>(crc ^ byte)];
+    }
+
+    /**
+     * @brief Finalize a streaming CRC calculation.
+     *
+     * @param crc   The CRC value after all Update() calls.
+     *
+     * @returns The finalized CRC-8 value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Finalize(std::uint8_t crc) noexcept
+    {
+        if constexpr (reflect_output != reflect_input) {
+            crc = __Internal::__Reflect8(crc);
+        }
+        return static_cast<std::uint8_t>(crc ^ final_xor);
+    }
+
+    /**
+     * @brief Get the initial value for streaming calculations.
+     *
+     * @returns The initial CRC value.
+     */
+    [[nodiscard]]
+    static constexpr std::uint8_t Init() noexcept
+    {
+        if constexpr (reflect_input) {
+            return __Internal::__Reflect8(initial_value);
+        } else {
+            return initial_value;
+        }
+    }
+
+    /**
+     * @brief Access the precomputed lookup table.
+     *
+     * @returns Reference to the 256-entry lookup table.
+     */
+    [[nodiscard]]
+    static constexpr const std::array<std::uint8_t, 256>& Table() noexcept
+    {
+        return s_table;
+    }
+
+private:
+    /** @brief Compile-time generated lookup table. */
+    static constexpr std::array<std::uint8_t, 256> s_table =
+        __Internal::__GenerateCrc8Table<polynomial, reflect_input>();
+};
+
+/* ==================== Predefined CRC-8 Variants ==================== */
+
+/**
+ * @brief CRC-8/SMBUS - SMBus Packet Error Code (PEC).
+ *
+ * Poly: 0x07, Init: 0x00, No reflection, No final XOR.
+ */
+using Crc8Smbus = Crc8<
+    Crc8Polynomial<0x07>,
+    Crc8InitialValue<0x00>,
+    Crc8FinalXor<0x00>,
+    Crc8ReflectInput<false>,
+    Crc8ReflectOutput<false>
+>;
+
+/**
+ * @brief CRC-8/MAXIM - Used in Dallas/Maxim 1-Wire devices.
+ *
+ * Poly: 0x31, Init: 0x00, With reflection, No final XOR.
+ */
+using Crc8Maxim = Crc8<
+    Crc8Polynomial<0x31>,
+    Crc8InitialValue<0x00>,
+    Crc8FinalXor<0x00>,
+    Crc8ReflectInput<true>,
+    Crc8ReflectOutput<true>
+>;
+
+/**
+ * @brief CRC-8/NRSC-5 variant used by Sensirion sensors (SHT3x, SCD4x, SGP).
+ *
+ * Poly: 0x31, Init: 0xFF, No reflection, No final XOR.
+ */
+using Crc8Sensirion = Crc8<
+    Crc8Polynomial<0x31>,
+    Crc8InitialValue<0xFF>,
+    Crc8FinalXor<0x00>,
+    Crc8ReflectInput<false>,
+    Crc8ReflectOutput<false>
+>;
+
+/**
+ * @brief CRC-8/SAE-J1850 - Used in automotive networks.
+ *
+ * Poly: 0x1D, Init: 0xFF, No reflection, Final XOR 0xFF.
+ */
+using Crc8SaeJ1850 = Crc8<
+    Crc8Polynomial<0x1D>,
+    Crc8InitialValue<0xFF>,
+    Crc8FinalXor<0xFF>,
+    Crc8ReflectInput<false>,
+    Crc8ReflectOutput<false>
+>;
+
+} /* namespace STM32 */
+
+#endif /* STM32_CRC8_HPP */
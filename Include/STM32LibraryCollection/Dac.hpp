@@ -290,35 +290,68 @@ public:
             &m_handle,
             std::to_underlying(DacChannelV),
             DacConfigT::AlignmentT::alignment,
-            ConvertToDac(
-                std::clamp(
-                    static_cast<double>(output),
-                    DacConfigT::InputRangeT::min_value,
-                    DacConfigT::InputRangeT::max_value
-                )
-            )
+            ConvertToDac(output)
         );
     }
 
 private:
     DAC_HandleTypeDef& m_handle;
 
+    using InputRangeT = typename DacConfigT::InputRangeT;
+    using AlignmentT = typename DacConfigT::AlignmentT;
+
+    /**
+     * @brief Conversions use integer fixed-point arithmetic when the input
+     *        range and resolution are whole numbers (all predefined configurations).
+     */
+    static constexpr bool integer_scaling{
+        __Internal::__IsWholeUint32(InputRangeT::min_value) &&
+        __Internal::__IsWholeUint32(InputRangeT::max_value) &&
+        __Internal::__IsWholeUint32(AlignmentT::resolution) &&
+        __Internal::__FixedPointScale::Fits(
+            static_cast<std::uint64_t>(InputRangeT::range_size),
+            static_cast<std::uint64_t>(InputRangeT::range_size),
+            __Internal::__FixedPointRounding::Down
+        )
+    };
+
     /**
      * @brief Convert output value to DAC value based on alignment.
      * 
-     * @param output        Output value to convert.
+     * @param output        Output value to convert, clamped to the input range.
      * 
      * @returns Corresponding DAC value.
+     *
+     * @note The integer path returns the exact truncated result in a multiply and a shift.
      */
-    constexpr std::uint32_t ConvertToDac(double output) const noexcept
+    constexpr std::uint32_t ConvertToDac(std::uint32_t output) const noexcept
     {
-        auto normalized{
-            (output - DacConfigT::InputRangeT::min_value) /
-            DacConfigT::InputRangeT::range_size
-        };
-        return static_cast<std::uint32_t>(
-            normalized * DacConfigT::AlignmentT::resolution
-        );
+        if constexpr (integer_scaling) {
+            constexpr auto min_value = static_cast<std::uint32_t>(InputRangeT::min_value);
+            constexpr auto max_value = static_cast<std::uint32_t>(InputRangeT::max_value);
+            constexpr auto scale = __Internal::__FixedPointScale::Make(
+                static_cast<std::uint64_t>(AlignmentT::resolution),
+                0,
+                static_cast<std::uint64_t>(InputRangeT::range_size),
+                static_cast<std::uint64_t>(InputRangeT::range_size),
+                __Internal::__FixedPointRounding::Down
+            );
+            return static_cast<std::uint32_t>(
+                scale.Apply(std::clamp(output, min_value, max_value) - min_value)
+            );
+        } else {
+            const double normalized{
+                (std::clamp(
+                    static_cast<double>(output),
+                    InputRangeT::min_value,
+                    InputRangeT::max_value
+                ) - InputRangeT::min_value) /
+                InputRangeT::range_size
+            };
+            return static_cast<std::uint32_t>(
+                normalized * AlignmentT::resolution
+            );
+        }
     }
 };
 
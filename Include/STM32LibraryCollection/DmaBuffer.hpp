@@ -0,0 +1,208 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_DMA_BUFFER_HPP
+#define STM32_DMA_BUFFER_HPP
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "__Internal/__DCache.hpp"
+
+namespace STM32 {
+
+template <typename T, std::size_t SizeV>
+class DmaBuffer;
+
+/**
+ * @class DmaSpan, A span over a whole DmaBuffer.
+ *
+ * Only DmaBuffer::Span() creates it, so it always starts on a cache line and
+ * the cache lines after its end belong to the buffer padding. Type-erased users
+ * (e.g., I2cTransfer, register buses) take it instead of std::span so a DMA
+ * receive never invalidates unrelated data. Sub-spans are plain std::span.
+ *
+ * @tparam T        Element type.
+ * @tparam ExtentV  Number of elements, or std::dynamic_extent.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/DmaBuffer.hpp>
+ *
+ * STM32::DmaBuffer<std::uint8_t, 6> accel{};
+ * STM32::DmaSpan<std::uint8_t> rx_message = accel.Span();
+ * @endcode
+ */
+template <typename T, std::size_t ExtentV = std::dynamic_extent>
+class DmaSpan : public std::span<T, ExtentV> {
+public:
+    /** The storage after the span is cache line padding (see __IsDCachePaddedSpan) */
+    static constexpr bool is_dcache_padded{true};
+
+    /**
+     * @brief Construct an empty DmaSpan.
+     */
+    constexpr DmaSpan() noexcept = default;
+
+    /**
+     * @brief Convert from another DmaSpan (e.g., fixed to dynamic extent, or to const).
+     *
+     * @param other     DmaSpan to be converted.
+     */
+    template <typename U, std::size_t OtherExtentV>
+    requires (
+        std::is_convertible_v<U(*)[], T(*)[]> &&
+        (ExtentV == std::dynamic_extent || ExtentV == OtherExtentV)
+    )
+    constexpr DmaSpan(const DmaSpan<U, OtherExtentV>& other) noexcept
+      : std::span<T, ExtentV>{other.data(), other.size()}
+    { }
+
+private:
+    template <typename, std::size_t>
+    friend class DmaBuffer;
+
+    constexpr DmaSpan(T* data, std::size_t size) noexcept
+      : std::span<T, ExtentV>{data, size}
+    { }
+};
+
+/**
+ * @class DmaBuffer, A fixed-size buffer safe for DMA transfers on cores with data cache.
+ *
+ * On Cortex-M7 parts (STM32F7/H7) the buffer is aligned to a cache line and its
+ * storage is padded to a whole number of cache lines, so invalidating it after a
+ * DMA receive never discards unrelated data. On cores without data cache it is
+ * a plain array with no alignment or padding overhead.
+ *
+ * DmaBuffer models a contiguous sized range and is accepted wherever Uart, Spi
+ * and I2c accept a message buffer. In DMA mode on cached cores, receive buffers
+ * must be DmaBuffer (or another cache-line aligned and padded type), otherwise
+ * compilation fails.
+ *
+ * @tparam T        Element type (e.g., char for UART, std::uint8_t for SPI/I2C).
+ * @tparam SizeV    Number of elements. size() always returns SizeV, padding is hidden.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/DmaBuffer.hpp>
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi1};
+ *
+ * STM32::DmaBuffer<std::uint8_t, 64> rx_data{};
+ * spi.ReceiveTo(rx_data, [](){
+ *     // D-cache already invalidated, rx_data holds the received bytes
+ * });
+ * @endcode
+ */
+template <typename T, std::size_t SizeV>
+class alignas(
+    STM32_DCACHE_PRESENT ? __Internal::__dcache_line_size : alignof(T)
+) DmaBuffer {
+    static_assert(
+        SizeV > 0,
+        "DmaBuffer size must be greater than zero"
+    );
+    static constexpr std::size_t alignment{
+        STM32_DCACHE_PRESENT ? __Internal::__dcache_line_size : sizeof(T)
+    };
+    static constexpr std::size_t storage_size{
+        ((SizeV * sizeof(T) + alignment - 1) / alignment * alignment + sizeof(T) - 1) / sizeof(T)
+    };
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /**
+     * @returns Pointer to the first element.
+     */
+    [[nodiscard]]
+    constexpr T* data() noexcept
+    {
+        return m_storage.data();
+    }
+
+    /**
+     * @returns Pointer to the first element.
+     */
+    [[nodiscard]]
+    constexpr const T* data() const noexcept
+    {
+        return m_storage.data();
+    }
+
+    /**
+     * @returns Number of elements (excluding cache line padding).
+     */
+    [[nodiscard]]
+    static constexpr std::size_t size() noexcept
+    {
+        return SizeV;
+    }
+
+    /**
+     * @defgroup Iterators over the usable elements.
+     * @{
+     */
+    [[nodiscard]] constexpr T* begin() noexcept { return data(); }
+    [[nodiscard]] constexpr const T* begin() const noexcept { return data(); }
+    [[nodiscard]] constexpr T* end() noexcept { return data() + SizeV; }
+    [[nodiscard]] constexpr const T* end() const noexcept { return data() + SizeV; }
+    /** @} */
+
+    /**
+     * @brief Access an element without bounds checking.
+     *
+     * @param index     Element index.
+     *
+     * @returns Reference to the element.
+     */
+    [[nodiscard]]
+    constexpr T& operator[](std::size_t index) noexcept
+    {
+        return m_storage[index];
+    }
+
+    /**
+     * @brief Access an element without bounds checking.
+     *
+     * @param index     Element index.
+     *
+     * @returns Const reference to the element.
+     */
+    [[nodiscard]]
+    constexpr const T& operator[](std::size_t index) const noexcept
+    {
+        return m_storage[index];
+    }
+
+    /**
+     * @returns A span over the usable elements that keeps the padding guarantee.
+     */
+    [[nodiscard]]
+    constexpr DmaSpan<T, SizeV> Span() noexcept
+    {
+        return DmaSpan<T, SizeV>{data(), SizeV};
+    }
+
+    /**
+     * @returns A span over the usable elements that keeps the padding guarantee.
+     */
+    [[nodiscard]]
+    constexpr DmaSpan<const T, SizeV> Span() const noexcept
+    {
+        return DmaSpan<const T, SizeV>{data(), SizeV};
+    }
+
+private:
+    std::array<T, storage_size> m_storage{};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_DMA_BUFFER_HPP */
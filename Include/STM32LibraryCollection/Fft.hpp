@@ -0,0 +1,658 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_FFT_HPP
+#define STM32_FFT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "__Internal/__Constant.hpp"
+#include "__Internal/__Math.hpp"
+#include "__Internal/__Simd.hpp"
+
+namespace STM32 {
+
+/**
+ * @brief IsFftSample, A concept to check if a type is a fixed-point FFT sample.
+ *
+ * std::int16_t selects Q15 and std::int32_t selects Q31 arithmetic.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsFftSample<std::int16_t>);
+ * static_assert(STM32::IsFftSample<std::int32_t>);
+ * static_assert(!STM32::IsFftSample<float>);
+ * @endcode
+ */
+template <typename T>
+concept IsFftSample =
+    std::same_as<T, std::int16_t> ||
+    std::same_as<T, std::int32_t>;
+
+/**
+ * @struct FftSize, A utility struct to hold the number of points of an FFT.
+ *
+ * @tparam SizeV    Number of points, a power of two between 16 and 4096.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using MySize = STM32::FftSize<256>;
+ * auto points = MySize::value; // points is 256.
+ * @endcode
+ */
+template <std::uint32_t SizeV>
+struct FftSize : __Internal::__Constant<std::uint32_t, SizeV> {
+    static_assert(
+        std::has_single_bit(SizeV) && 16 <= SizeV && SizeV <= 4096,
+        "FFT size must be a power of two between 16 and 4096!"
+    );
+};
+
+/**
+ * @brief IsFftSize, A concept to check if a type is an FftSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsFftSize<STM32::FftSize<256>>);
+ * static_assert(!STM32::IsFftSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFftSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    std::has_single_bit(T::value) && 16 <= T::value && T::value <= 4096;
+
+/**
+ * @struct FftSampleBits, A utility struct to hold the number of significant bits of ADC samples.
+ *
+ * Unsigned samples are centred on half of their range, 2^(BitsV - 1).
+ *
+ * @tparam BitsV    Significant bits of the samples (1-16), e.g., 12 for a 12-bit ADC.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using Adc12Bit = STM32::FftSampleBits<12>;
+ * auto bits = Adc12Bit::value; // bits is 12.
+ * @endcode
+ */
+template <std::uint32_t BitsV>
+struct FftSampleBits : __Internal::__Constant<std::uint32_t, BitsV> {
+    static_assert(
+        1 <= BitsV && BitsV <= 16,
+        "Sample bits must be between 1 and 16!"
+    );
+};
+
+/**
+ * @brief IsFftSampleBits, A concept to check if a type is an FftSampleBits.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsFftSampleBits<STM32::FftSampleBits<12>>);
+ * static_assert(!STM32::IsFftSampleBits<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFftSampleBits =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    1 <= T::value && T::value <= 16;
+
+/**
+ * @struct FftComplex, A fixed-point complex value, real part first.
+ *
+ * @tparam SampleT  Part type, std::int16_t for Q15 or std::int32_t for Q31.
+ */
+template <IsFftSample SampleT>
+struct FftComplex {
+    SampleT re;
+    SampleT im;
+};
+
+/**
+ * @class Fft, In-place fixed-point fast Fourier transform.
+ *
+ * A decimation-in-time transform on bit-reversed data: radix-4 stages with
+ * three complex multiplications per four points, preceded by one radix-2
+ * stage when log2(SizeT) is odd. The twiddle factors are generated at compile
+ * time for SizeT and stored in flash. Every stage divides by its radix with
+ * rounding, so the output is the DFT scaled by 1 / SizeT and cannot overflow
+ * for inputs of magnitude up to 1. Products and sums are kept in 32 bits (Q15)
+ * or 64 bits (Q31) within a stage. On cores with the DSP extension
+ * (STM32_SIMD32) a Q15 complex multiplication is one SMUSD and one SMUADX,
+ * which give the same integers as the scalar path.
+ *
+ * @tparam SampleT      std::int16_t for Q15 or std::int32_t for Q31.
+ * @tparam SizeT        Number of points (e.g., FftSize<256>).
+ * @tparam SampleBitsT  Significant bits of the ADC samples (default is 12).
+ *
+ * @note Bin k of a transform of samples taken at fs is at k * fs / SizeT, and
+ *       a sine of amplitude A codes gives A / 2 codes (scaled to Q) in bins k
+ *       and SizeT - k.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using Fft = STM32::Fft<std::int16_t, STM32::FftSize<256>>;
+ * std::array<Fft::ComplexT, 256> spectrum{};
+ *
+ * if (const auto* block = acquisition.GetReadyBlock()) {
+ *     Fft::Transform(block->Channel(0), spectrum);
+ *     acquisition.ReleaseBlock();
+ *     auto power = Fft::GetPower(spectrum[10]);
+ * }
+ * @endcode
+ */
+template <IsFftSample SampleT, IsFftSize SizeT, IsFftSampleBits SampleBitsT = FftSampleBits<12>>
+class Fft {
+    using WideT = std::conditional_t<std::same_as<SampleT, std::int16_t>, std::int32_t, std::int64_t>;
+    static constexpr std::uint32_t fraction_bits{std::numeric_limits<SampleT>::digits};
+
+    struct WideComplex {
+        WideT re;
+        WideT im;
+    };
+public:
+    using ComplexT = FftComplex<SampleT>;
+
+    /**
+     * @brief Transform complex data in place.
+     *
+     * @param data      Time-domain input, replaced by the spectrum in natural order.
+     */
+    static void Transform(std::span<ComplexT, SizeT::value> data) noexcept
+    {
+        Reverse(data);
+        std::uint32_t span{1};
+        if constexpr (std::countr_zero(SizeT::value) % 2 == 1) {
+            for (std::uint32_t i{}; i < SizeT::value; i += 2) {
+                const WideComplex first{data[i].re, data[i].im};
+                const WideComplex second{data[i + 1].re, data[i + 1].im};
+                data[i] = Narrow({first.re + second.re, first.im + second.im}, 1);
+                data[i + 1] = Narrow({first.re - second.re, first.im - second.im}, 1);
+            }
+            span = 2;
+        }
+        for (; span < SizeT::value; span *= 4) {
+            const std::uint32_t stride{SizeT::value / (4 * span)};
+            for (std::uint32_t offset{}; offset < SizeT::value; offset += 4 * span) {
+                Butterfly<true>(data, offset, span, twiddles[0], twiddles[0], twiddles[0]);
+            }
+            for (std::uint32_t k{1}; k < span; ++k) {
+                const ComplexT first{twiddles[k * stride]};
+                const ComplexT second{twiddles[2 * k * stride]};
+                const ComplexT third{twiddles[3 * k * stride]};
+                for (std::uint32_t offset{k}; offset < SizeT::value; offset += 4 * span) {
+                    Butterfly<false>(data, offset, span, first, second, third);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Transform a block of ADC samples.
+     *
+     * Samples are centred on half of their range and scaled to full scale,
+     * so the DC component of a mid-scale signal is 0.
+     *
+     * @param samples   Unsigned samples (e.g., AdcAcquisitionBlock::Channel()).
+     * @param spectrum  Destination of the spectrum in natural order.
+     */
+    static void Transform(
+        std::span<const std::uint16_t, SizeT::value> samples,
+        std::span<ComplexT, SizeT::value> spectrum
+    ) noexcept
+    {
+        constexpr std::int32_t offset{std::int32_t{1} << (SampleBitsT::value - 1)};
+        constexpr std::uint32_t shift{fraction_bits + 1 - SampleBitsT::value};
+        for (std::size_t i{}; i < SizeT::value; ++i) {
+            spectrum[i] = {
+                static_cast<SampleT>(static_cast<WideT>(samples[i] - offset) * (WideT{1} << shift)),
+                0
+            };
+        }
+        Transform(spectrum);
+    }
+
+    /**
+     * @param bin       Spectrum bin.
+     *
+     * @returns Squared magnitude of the bin, re^2 + im^2.
+     */
+    [[nodiscard]]
+    static constexpr std::uint64_t GetPower(const ComplexT& bin) noexcept
+    {
+        const std::int64_t re{bin.re};
+        const std::int64_t im{bin.im};
+        return static_cast<std::uint64_t>(re * re) + static_cast<std::uint64_t>(im * im);
+    }
+
+private:
+    /**
+     * @returns W^k = exp(-2 * pi * i * k / SizeT) for k in [0, 3 * SizeT / 4), as needed by the last radix-4 stage.
+     */
+    static constexpr std::array<ComplexT, 3 * SizeT::value / 4> GenerateTwiddles() noexcept
+    {
+        constexpr double one{static_cast<double>(std::uint64_t{1} << fraction_bits)};
+        constexpr std::int64_t max{std::numeric_limits<SampleT>::max()};
+        std::array<ComplexT, 3 * SizeT::value / 4> table{};
+        for (std::uint32_t k{}; k < table.size(); ++k) {
+            const auto [cosine, sine] = __Internal::__CosSinTurn(k, SizeT::value);
+            table[k] = {
+                static_cast<SampleT>(std::min(__Internal::__RoundToInt64(cosine * one), max)),
+                static_cast<SampleT>(std::min(__Internal::__RoundToInt64(-sine * one), max))
+            };
+        }
+        return table;
+    }
+
+    static constexpr auto twiddles = GenerateTwiddles();
+
+    /**
+     * @brief Divide by 2^shift, rounding to nearest, and saturate.
+     */
+    static constexpr ComplexT Narrow(WideComplex value, std::uint32_t shift) noexcept
+    {
+        const auto narrow = [shift](WideT part){
+            part = (part + (WideT{1} << (shift - 1))) >> shift;
+            return static_cast<SampleT>(std::clamp<WideT>(
+                part, std::numeric_limits<SampleT>::min(), std::numeric_limits<SampleT>::max()
+            ));
+        };
+        return {narrow(value.re), narrow(value.im)};
+    }
+
+    /**
+     * @returns value * twiddle, rounded to nearest, not narrowed.
+     */
+    static WideComplex Multiply(ComplexT value, ComplexT twiddle) noexcept
+    {
+        constexpr WideT half{WideT{1} << (fraction_bits - 1)};
+#if STM32_SIMD32
+        if constexpr (std::same_as<SampleT, std::int16_t>) {
+            std::int32_t packed_value;
+            std::int32_t packed_twiddle;
+            std::memcpy(&packed_value, &value, sizeof(packed_value));
+            std::memcpy(&packed_twiddle, &twiddle, sizeof(packed_twiddle));
+            return {
+                (__smusd(packed_value, packed_twiddle) + half) >> fraction_bits,
+                (__smuadx(packed_value, packed_twiddle) + half) >> fraction_bits
+            };
+        }
+#endif /* STM32_SIMD32 */
+        return {
+            (WideT{value.re} * twiddle.re - WideT{value.im} * twiddle.im + half) >> fraction_bits,
+            (WideT{value.re} * twiddle.im + WideT{value.im} * twiddle.re + half) >> fraction_bits
+        };
+    }
+
+    /**
+     * @brief Radix-4 butterfly on offset + {0, 1, 2, 3} * span.
+     *
+     * @tparam UnityV   True for k = 0, where all twiddles are 1 and the multiplications are skipped.
+     */
+    template <bool UnityV>
+    static void Butterfly(
+        std::span<ComplexT, SizeT::value> data,
+        std::uint32_t offset,
+        std::uint32_t span,
+        ComplexT first,
+        ComplexT second,
+        ComplexT third
+    ) noexcept
+    {
+        ComplexT& x0{data[offset]};
+        ComplexT& x1{data[offset + span]};
+        ComplexT& x2{data[offset + 2 * span]};
+        ComplexT& x3{data[offset + 3 * span]};
+        const WideComplex a{x0.re, x0.im};
+        WideComplex b{x1.re, x1.im};
+        WideComplex c{x2.re, x2.im};
+        WideComplex d{x3.re, x3.im};
+        if constexpr (!UnityV) {
+            b = Multiply(x1, second);
+            c = Multiply(x2, first);
+            d = Multiply(x3, third);
+        }
+        const WideComplex sum_ab{a.re + b.re, a.im + b.im};
+        const WideComplex difference_ab{a.re - b.re, a.im - b.im};
+        const WideComplex sum_cd{c.re + d.re, c.im + d.im};
+        const WideComplex difference_cd{c.re - d.re, c.im - d.im};
+        x0 = Narrow({sum_ab.re + sum_cd.re, sum_ab.im + sum_cd.im}, 2);
+        x1 = Narrow({difference_ab.re + difference_cd.im, difference_ab.im - difference_cd.re}, 2);
+        x2 = Narrow({sum_ab.re - sum_cd.re, sum_ab.im - sum_cd.im}, 2);
+        x3 = Narrow({difference_ab.re - difference_cd.im, difference_ab.im + difference_cd.re}, 2);
+    }
+
+    /**
+     * @brief Bit-reversal permutation.
+     */
+    static void Reverse(std::span<ComplexT, SizeT::value> data) noexcept
+    {
+        for (std::uint32_t i{1}, j{0}; i < SizeT::value; ++i) {
+            std::uint32_t bit{SizeT::value >> 1};
+            for (; (j & bit) != 0; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+    }
+};
+
+/**
+ * @struct GoertzelFrequency, A utility struct to hold the frequency of a tone in Hz.
+ *
+ * @tparam FrequencyV   Frequency in Hz.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using Dtmf697Hz = STM32::GoertzelFrequency<697>;
+ * auto frequency = Dtmf697Hz::value; // frequency is 697.
+ * @endcode
+ */
+template <std::uint32_t FrequencyV>
+struct GoertzelFrequency : __Internal::__Constant<std::uint32_t, FrequencyV> {
+    static_assert(
+        FrequencyV > 0,
+        "Frequency must be greater than 0!"
+    );
+};
+
+/**
+ * @brief IsGoertzelFrequency, A concept to check if a type is a GoertzelFrequency.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsGoertzelFrequency<STM32::GoertzelFrequency<697>>);
+ * static_assert(!STM32::IsGoertzelFrequency<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsGoertzelFrequency =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    T::value > 0;
+
+/**
+ * @struct GoertzelSampleRate, A utility struct to hold the sample rate in Hz.
+ *
+ * @tparam RateV    Sample rate in Hz.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using MyRate = STM32::GoertzelSampleRate<8000>;
+ * auto rate = MyRate::value; // rate is 8000.
+ * @endcode
+ */
+template <std::uint32_t RateV>
+struct GoertzelSampleRate : __Internal::__Constant<std::uint32_t, RateV> {
+    static_assert(
+        RateV > 0,
+        "Sample rate must be greater than 0!"
+    );
+};
+
+/**
+ * @brief IsGoertzelSampleRate, A concept to check if a type is a GoertzelSampleRate.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsGoertzelSampleRate<STM32::GoertzelSampleRate<8000>>);
+ * static_assert(!STM32::IsGoertzelSampleRate<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsGoertzelSampleRate =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    T::value > 0;
+
+/**
+ * @struct GoertzelBlockSize, A utility struct to hold the number of samples per detection.
+ *
+ * @tparam SizeV    Samples per detection (1-65535), the bandwidth is about sample rate / SizeV.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * using MyBlock = STM32::GoertzelBlockSize<205>;
+ * auto size = MyBlock::value; // size is 205.
+ * @endcode
+ */
+template <std::uint32_t SizeV>
+struct GoertzelBlockSize : __Internal::__Constant<std::uint32_t, SizeV> {
+    static_assert(
+        0 < SizeV && SizeV <= 65535,
+        "Block size must be between 1 and 65535 samples!"
+    );
+};
+
+/**
+ * @brief IsGoertzelBlockSize, A concept to check if a type is a GoertzelBlockSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * static_assert(STM32::IsGoertzelBlockSize<STM32::GoertzelBlockSize<205>>);
+ * static_assert(!STM32::IsGoertzelBlockSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsGoertzelBlockSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    0 < T::value && T::value <= 65535;
+
+namespace __Internal {
+
+/**
+ * @brief Multiply by a Q30 coefficient, rounding to nearest, without a 64 x 64-bit product.
+ *
+ * @param coefficient   Q30 coefficient.
+ * @param value         Value, |value| < 2^62.
+ *
+ * @returns coefficient * value / 2^30.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr std::int64_t __MultiplyQ30(std::int32_t coefficient, std::int64_t value) noexcept
+{
+    const auto high = static_cast<std::int32_t>(value >> 32);
+    const auto low = static_cast<std::uint32_t>(value);
+    return std::int64_t{coefficient} * high * 4 +
+           ((std::int64_t{coefficient} * low + (std::int64_t{1} << 29)) >> 30);
+}
+
+} /* namespace __Internal */
+
+/**
+ * @class Goertzel, Streaming single-frequency detector.
+ *
+ * Runs the Goertzel resonator on every sample and evaluates the power of
+ * FrequencyT once per BlockSizeT samples, which costs one multiplication per
+ * sample instead of a full FFT when only a few tones are of interest (e.g.,
+ * DTMF, pilot tones). The frequency need not be a multiple of
+ * SampleRateT / BlockSizeT, but it must lie at least one bin
+ * (SampleRateT / BlockSizeT) away from 0 and from half of the sample rate:
+ * closer to either, the resonator state grows with the square of the block
+ * size. The resonator uses Q30 coefficients and 64-bit state, which cannot
+ * overflow under that condition.
+ *
+ * @tparam FrequencyT   Frequency of the tone, at least one bin above 0 and below half
+ *                      of the sample rate.
+ * @tparam SampleRateT  Sample rate (e.g., AdcSampleRate of AdcAcquisition).
+ * @tparam BlockSizeT   Samples per detection.
+ * @tparam SampleBitsT  Significant bits of the ADC samples (default is 12).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Fft.hpp>
+ *
+ * STM32::Goertzel<
+ *     STM32::GoertzelFrequency<1000>,
+ *     STM32::GoertzelSampleRate<48000>,
+ *     STM32::GoertzelBlockSize<480>
+ * > tone{};
+ *
+ * if (const auto* block = acquisition.GetReadyBlock()) {
+ *     if (tone.Update(block->Channel(0)) && tone.GetAmplitude() > 100) {
+ *         // 1 kHz tone present with more than 100 codes of amplitude
+ *     }
+ *     acquisition.ReleaseBlock();
+ * }
+ * @endcode
+ */
+template <
+    IsGoertzelFrequency FrequencyT,
+    IsGoertzelSampleRate SampleRateT,
+    IsGoertzelBlockSize BlockSizeT,
+    IsFftSampleBits SampleBitsT = FftSampleBits<12>
+>
+class Goertzel {
+    static_assert(
+        2 * std::uint64_t{FrequencyT::value} < SampleRateT::value,
+        "Frequency must be below half of the sample rate!"
+    );
+    static_assert(
+        std::uint64_t{FrequencyT::value} * BlockSizeT::value >= SampleRateT::value &&
+        (SampleRateT::value - 2 * std::uint64_t{FrequencyT::value}) * BlockSizeT::value >=
+            2 * std::uint64_t{SampleRateT::value},
+        "Frequency must be at least one bin (sample rate / block size) away from 0 and half of the sample rate!"
+    );
+
+    static constexpr double one{static_cast<double>(std::int64_t{1} << 30)};
+    static constexpr auto cos_sin = __Internal::__CosSinTurn(FrequencyT::value, SampleRateT::value);
+    static constexpr auto cosine = static_cast<std::int32_t>(__Internal::__RoundToInt64(cos_sin.first * one));
+    static constexpr auto sine = static_cast<std::int32_t>(__Internal::__RoundToInt64(cos_sin.second * one));
+    static constexpr auto coefficient = static_cast<std::int32_t>(std::min<std::int64_t>(
+        __Internal::__RoundToInt64(2. * cos_sin.first * one), std::numeric_limits<std::int32_t>::max()
+    ));
+    static constexpr std::int64_t offset{std::int64_t{1} << (SampleBitsT::value - 1)};
+public:
+
+    /**
+     * @brief Add a sample.
+     *
+     * @param sample    New unsigned sample.
+     *
+     * @returns True if a block completed and GetPower() was updated.
+     */
+    constexpr bool Update(std::uint16_t sample) noexcept
+    {
+        const std::int64_t state{sample - offset + __Internal::__MultiplyQ30(coefficient, m_state) - m_previous_state};
+        m_previous_state = m_state;
+        m_state = state;
+        if (++m_count < BlockSizeT::value) {
+            return false;
+        }
+        const std::int64_t re{m_state - __Internal::__MultiplyQ30(cosine, m_previous_state)};
+        const std::int64_t im{__Internal::__MultiplyQ30(sine, m_previous_state)};
+        m_power = static_cast<std::uint64_t>(re * re) + static_cast<std::uint64_t>(im * im);
+        m_state = 0;
+        m_previous_state = 0;
+        m_count = 0;
+        return true;
+    }
+
+    /**
+     * @brief Add a block of samples (e.g., AdcAcquisitionBlock::Channel()).
+     *
+     * @param samples   New unsigned samples, oldest first.
+     *
+     * @returns True if at least one block completed, GetPower() is of the latest.
+     */
+    constexpr bool Update(std::span<const std::uint16_t> samples) noexcept
+    {
+        bool completed{false};
+        for (const auto sample : samples) {
+            completed = Update(sample) || completed;
+        }
+        return completed;
+    }
+
+    /**
+     * @returns Squared magnitude of the DFT of the latest block at FrequencyT, 0 before the first block.
+     */
+    [[nodiscard]]
+    constexpr std::uint64_t GetPower() const noexcept
+    {
+        return m_power;
+    }
+
+    /**
+     * @returns Amplitude of the tone in the latest block in codes, 2 * sqrt(GetPower()) / BlockSizeT.
+     */
+    [[nodiscard]]
+    constexpr std::uint32_t GetAmplitude() const noexcept
+    {
+        return static_cast<std::uint32_t>(
+            (2 * std::uint64_t{__Internal::__Isqrt(m_power)} + BlockSizeT::value / 2) / BlockSizeT::value
+        );
+    }
+
+    /**
+     * @brief Discard the current block and the latest result.
+     */
+    constexpr void Reset() noexcept
+    {
+        *this = Goertzel{};
+    }
+
+private:
+    std::int64_t m_state{0};
+    std::int64_t m_previous_state{0};
+    std::uint64_t m_power{0};
+    std::uint32_t m_count{0};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_FFT_HPP */
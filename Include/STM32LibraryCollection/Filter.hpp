@@ -0,0 +1,794 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_FILTER_HPP
+#define STM32_FILTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "__Internal/__Constant.hpp"
+
+namespace STM32 {
+
+/**
+ * @brief IsFilterSample, A concept to check if a type can be filtered.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * static_assert(STM32::IsFilterSample<std::uint16_t>);
+ * static_assert(STM32::IsFilterSample<float>);
+ * static_assert(!STM32::IsFilterSample<bool>);
+ * @endcode
+ */
+template <typename T>
+concept IsFilterSample =
+    (std::integral<T> && !std::same_as<T, bool>) ||
+    std::floating_point<T>;
+
+/**
+ * @struct FilterWindow, A utility struct to hold the number of samples in a sliding window.
+ *
+ * @tparam WindowV  Number of samples in the window.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * using MyWindow = STM32::FilterWindow<16>;
+ * auto size = MyWindow::value; // size is 16.
+ * @endcode
+ */
+template <std::size_t WindowV>
+struct FilterWindow : __Internal::__Constant<std::size_t, WindowV> {
+    static_assert(
+        0 < WindowV && WindowV <= 65535,
+        "Window must be between 1 and 65535 samples!"
+    );
+};
+
+/**
+ * @brief IsFilterWindow, A concept to check if a type is a FilterWindow.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * static_assert(STM32::IsFilterWindow<STM32::FilterWindow<16>>);
+ * static_assert(!STM32::IsFilterWindow<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFilterWindow =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    0 < T::value && T::value <= 65535;
+
+/**
+ * @struct EmaShift, A utility struct to hold the smoothing factor of an EMA as a power of two.
+ *
+ * @tparam ShiftV   Smoothing factor is 1 / 2^ShiftV (1-15).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * using MyShift = STM32::EmaShift<4>; // alpha = 1/16
+ * auto shift = MyShift::value; // shift is 4.
+ * @endcode
+ */
+template <std::uint32_t ShiftV>
+struct EmaShift : __Internal::__Constant<std::uint32_t, ShiftV> {
+    static_assert(
+        1 <= ShiftV && ShiftV <= 15,
+        "EMA shift must be between 1 and 15!"
+    );
+};
+
+/**
+ * @brief IsEmaShift, A concept to check if a type is an EmaShift.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * static_assert(STM32::IsEmaShift<STM32::EmaShift<4>>);
+ * static_assert(!STM32::IsEmaShift<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsEmaShift =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    1 <= T::value && T::value <= 15;
+
+/**
+ * @struct CicDecimation, A utility struct to hold the decimation ratio of a CIC filter.
+ *
+ * @tparam RatioV   Input samples per output sample (2-65535).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * using MyRatio = STM32::CicDecimation<16>;
+ * auto ratio = MyRatio::value; // ratio is 16.
+ * @endcode
+ */
+template <std::uint32_t RatioV>
+struct CicDecimation : __Internal::__Constant<std::uint32_t, RatioV> {
+    static_assert(
+        2 <= RatioV && RatioV <= 65535,
+        "CIC decimation ratio must be between 2 and 65535!"
+    );
+};
+
+/**
+ * @brief IsCicDecimation, A concept to check if a type is a CicDecimation.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * static_assert(STM32::IsCicDecimation<STM32::CicDecimation<16>>);
+ * static_assert(!STM32::IsCicDecimation<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsCicDecimation =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    2 <= T::value && T::value <= 65535;
+
+/**
+ * @struct CicStages, A utility struct to hold the number of integrator/comb stage pairs.
+ *
+ * @tparam StagesV  Number of stages (1-6), more stages attenuate aliasing more.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * using MyStages = STM32::CicStages<3>;
+ * auto stages = MyStages::value; // stages is 3.
+ * @endcode
+ */
+template <std::uint32_t StagesV>
+struct CicStages : __Internal::__Constant<std::uint32_t, StagesV> {
+    static_assert(
+        1 <= StagesV && StagesV <= 6,
+        "CIC stage count must be between 1 and 6!"
+    );
+};
+
+/**
+ * @brief IsCicStages, A concept to check if a type is a CicStages.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * static_assert(STM32::IsCicStages<STM32::CicStages<3>>);
+ * static_assert(!STM32::IsCicStages<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsCicStages =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    1 <= T::value && T::value <= 6;
+
+namespace __Internal {
+
+/**
+ * @brief Accumulator type holding the sum of ExtraBitsV bits worth of SampleT values.
+ *
+ * 32-bit when the sum fits, 64-bit otherwise, the sample type for floating point.
+ *
+ * @note This is an internal alias. Do not use directly in application code.
+ */
+template <typename SampleT, std::size_t ExtraBitsV>
+using __FilterAccumulatorT = std::conditional_t<
+    std::floating_point<SampleT>,
+    SampleT,
+    std::conditional_t<
+        (std::numeric_limits<SampleT>::digits + ExtraBitsV <= 31),
+        std::conditional_t<std::is_signed_v<SampleT>, std::int32_t, std::uint32_t>,
+        std::conditional_t<std::is_signed_v<SampleT>, std::int64_t, std::uint64_t>
+    >
+>;
+
+} /* namespace __Internal */
+
+/**
+ * @class MovingAverage, O(1) sliding window average with a running sum.
+ *
+ * Every update adds the new sample to the running sum and subtracts the
+ * sample leaving the window, so the cost does not depend on the window size.
+ * Until the window is full, the average of the samples seen so far is returned.
+ * For floating point samples the rounding errors of the running sum would
+ * accumulate without bound, so the sum is recomputed from the window every
+ * time the window wraps (amortized O(1)).
+ *
+ * @tparam SampleT  Sample type (e.g., std::uint16_t for ADC readings, float).
+ * @tparam WindowT  Window size (e.g., FilterWindow<16>), a power of two turns
+ *                  the division into a shift.
+ *
+ * @note Integer averages are truncated toward zero.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * STM32::MovingAverage<std::uint16_t, STM32::FilterWindow<16>> average{};
+ *
+ * auto smoothed = average.Update(adc_sample);
+ *
+ * // Feed a whole DMA block, returns the average after the last sample
+ * auto latest = average.Update(block->Channel(0));
+ * @endcode
+ */
+template <IsFilterSample SampleT, IsFilterWindow WindowT>
+class MovingAverage {
+    using AccumulatorT = __Internal::__FilterAccumulatorT<
+        SampleT, std::bit_width(WindowT::value)
+    >;
+public:
+
+    /**
+     * @brief Add a sample.
+     *
+     * @param sample    New sample.
+     *
+     * @returns Average of the window.
+     */
+    constexpr SampleT Update(SampleT sample) noexcept
+    {
+        m_sum += static_cast<AccumulatorT>(sample);
+        m_sum -= static_cast<AccumulatorT>(m_window[m_index]);
+        m_window[m_index] = sample;
+        m_index = (m_index + 1 == WindowT::value) ? 0 : m_index + 1;
+        if (m_count < WindowT::value) {
+            ++m_count;
+        }
+        if constexpr (std::floating_point<SampleT>) {
+            if (m_index == 0) {
+                m_sum = std::accumulate(m_window.begin(), m_window.end(), AccumulatorT{});
+            }
+        }
+        return Get();
+    }
+
+    /**
+     * @brief Add a block of samples.
+     *
+     * @param samples   New samples, oldest first.
+     *
+     * @returns Average of the window after the last sample.
+     */
+    constexpr SampleT Update(std::span<const SampleT> samples) noexcept
+    {
+        for (const auto sample : samples) {
+            Update(sample);
+        }
+        return Get();
+    }
+
+    /**
+     * @returns Average of the window, 0 before the first sample.
+     */
+    [[nodiscard]]
+    constexpr SampleT Get() const noexcept
+    {
+        if (m_count == WindowT::value) {
+            return static_cast<SampleT>(m_sum / static_cast<AccumulatorT>(WindowT::value));
+        }
+        if (m_count == 0) {
+            return SampleT{};
+        }
+        return static_cast<SampleT>(m_sum / static_cast<AccumulatorT>(m_count));
+    }
+
+    /**
+     * @returns True once the window holds WindowT samples.
+     */
+    [[nodiscard]]
+    constexpr bool IsFull() const noexcept
+    {
+        return m_count == WindowT::value;
+    }
+
+    /**
+     * @brief Clear the window.
+     */
+    constexpr void Reset() noexcept
+    {
+        *this = MovingAverage{};
+    }
+
+private:
+    std::array<SampleT, WindowT::value> m_window{};
+    AccumulatorT m_sum{};
+    std::size_t m_index{0};
+    std::size_t m_count{0};
+};
+
+/**
+ * @class Ema, Exponential moving average with a power of two smoothing factor.
+ *
+ * Computes y += (x - y) / 2^ShiftT with the state kept in fixed point with
+ * ShiftT fraction bits, so integer samples need one add, one subtract and
+ * two shifts per update and lose no resolution to truncation. The first
+ * sample initializes the state to avoid a start-up ramp.
+ *
+ * @tparam SampleT  Sample type (e.g., std::uint16_t for ADC readings, float).
+ * @tparam ShiftT   Smoothing factor 1 / 2^ShiftT (e.g., EmaShift<4>), the time
+ *                  constant is about 2^ShiftT samples.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * STM32::Ema<std::uint16_t, STM32::EmaShift<4>> ema{};
+ *
+ * auto smoothed = ema.Update(adc_sample);
+ * @endcode
+ */
+template <IsFilterSample SampleT, IsEmaShift ShiftT>
+class Ema {
+    using StateT = __Internal::__FilterAccumulatorT<SampleT, ShiftT::value + 1>;
+public:
+
+    /**
+     * @brief Add a sample.
+     *
+     * @param sample    New sample.
+     *
+     * @returns Smoothed value.
+     */
+    constexpr SampleT Update(SampleT sample) noexcept
+    {
+        if constexpr (std::floating_point<SampleT>) {
+            m_state = m_initialized ?
+                m_state + (sample - m_state) / static_cast<SampleT>(1U << ShiftT::value) :
+                sample;
+        } else {
+            m_state = m_initialized ?
+                m_state - (m_state >> ShiftT::value) + static_cast<StateT>(sample) :
+                static_cast<StateT>(sample) << ShiftT::value;
+        }
+        m_initialized = true;
+        return Get();
+    }
+
+    /**
+     * @brief Add a block of samples.
+     *
+     * @param samples   New samples, oldest first.
+     *
+     * @returns Smoothed value after the last sample.
+     */
+    constexpr SampleT Update(std::span<const SampleT> samples) noexcept
+    {
+        for (const auto sample : samples) {
+            Update(sample);
+        }
+        return Get();
+    }
+
+    /**
+     * @returns Smoothed value, 0 before the first sample.
+     */
+    [[nodiscard]]
+    constexpr SampleT Get() const noexcept
+    {
+        if constexpr (std::floating_point<SampleT>) {
+            return m_state;
+        } else {
+            return static_cast<SampleT>(m_state >> ShiftT::value);
+        }
+    }
+
+    /**
+     * @brief Forget the state, the next sample initializes it.
+     */
+    constexpr void Reset() noexcept
+    {
+        *this = Ema{};
+    }
+
+private:
+    StateT m_state{};
+    bool m_initialized{false};
+};
+
+/**
+ * @class RunningMedian, Sliding window median with O(log n) updates.
+ *
+ * The window is kept as a max-heap of the smaller half and a min-heap of the
+ * larger half sharing one index array, with the median at the boundary. The
+ * sample leaving the window is replaced in place by the new one and sifted
+ * through the heaps, so an update costs O(log WindowT) comparisons and no
+ * allocation.
+ *
+ * @tparam SampleT  Sample type (e.g., std::uint16_t for ADC readings, float).
+ * @tparam WindowT  Window size (e.g., FilterWindow<31>), odd sizes give a true median.
+ *
+ * @note The result is element count / 2 of the sorted window (the upper median
+ *       for an even count), like Adc::Get().
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * STM32::RunningMedian<std::uint16_t, STM32::FilterWindow<31>> median{};
+ *
+ * auto filtered = median.Update(adc_sample); // Rejects spikes shorter than 16 samples
+ * @endcode
+ */
+template <IsFilterSample SampleT, IsFilterWindow WindowT>
+class RunningMedian {
+    using IndexT = std::conditional_t<(WindowT::value < 32768), std::int16_t, std::int32_t>;
+    static constexpr std::size_t window{WindowT::value};
+public:
+
+    /**
+     * @brief Construct an empty window.
+     */
+    constexpr RunningMedian() noexcept
+    {
+        Reset();
+    }
+
+    /**
+     * @brief Add a sample.
+     *
+     * @param sample    New sample, replaces the oldest one when the window is full.
+     *
+     * @returns Median of the window.
+     */
+    constexpr SampleT Update(SampleT sample) noexcept
+    {
+        if constexpr (window == 1) {
+            m_samples[0] = sample;
+            m_count = 1;
+            return sample;
+        }
+        const bool is_new{m_count < window};
+        const int position{m_position[m_index]};
+        const SampleT old_sample{m_samples[m_index]};
+        m_samples[m_index] = sample;
+        m_index = (m_index + 1 == window) ? 0 : m_index + 1;
+        m_count += is_new;
+        if (position > 0) {
+            if (!is_new && old_sample < sample) {
+                MinSortDown(position * 2);
+            } else if (MinSortUp(position)) {
+                MaxSortDown(-1);
+            }
+        } else if (position < 0) {
+            if (!is_new && sample < old_sample) {
+                MaxSortDown(position * 2);
+            } else if (MaxSortUp(position)) {
+                MinSortDown(1);
+            }
+        } else {
+            if (MaxCount() > 0) {
+                MaxSortDown(-1);
+            }
+            if (MinCount() > 0) {
+                MinSortDown(1);
+            }
+        }
+        return Get();
+    }
+
+    /**
+     * @brief Add a block of samples.
+     *
+     * @param samples   New samples, oldest first.
+     *
+     * @returns Median of the window after the last sample.
+     */
+    constexpr SampleT Update(std::span<const SampleT> samples) noexcept
+    {
+        for (const auto sample : samples) {
+            Update(sample);
+        }
+        return Get();
+    }
+
+    /**
+     * @returns Median of the window, 0 before the first sample.
+     */
+    [[nodiscard]]
+    constexpr SampleT Get() const noexcept
+    {
+        return (m_count == 0) ? SampleT{} : m_samples[static_cast<std::size_t>(Heap(0))];
+    }
+
+    /**
+     * @returns True once the window holds WindowT samples.
+     */
+    [[nodiscard]]
+    constexpr bool IsFull() const noexcept
+    {
+        return m_count == window;
+    }
+
+    /**
+     * @brief Clear the window.
+     */
+    constexpr void Reset() noexcept
+    {
+        m_index = 0;
+        m_count = 0;
+        for (std::size_t i{window}; i-- > 0;) {
+            const int position{
+                static_cast<int>((i + 1) / 2) * ((i & 1) ? -1 : 1)
+            };
+            m_position[i] = static_cast<IndexT>(position);
+            Heap(position) = static_cast<IndexT>(i);
+        }
+    }
+
+private:
+    std::array<SampleT, window> m_samples{};
+    std::array<IndexT, window> m_position{};    /**< Heap position of each sample */
+    std::array<IndexT, window> m_heap{};        /**< Sample index at each heap position, median at offset */
+    std::size_t m_index{0};
+    std::size_t m_count{0};
+
+    /**
+     * @returns Sample index at a heap position, negative positions are the max-heap.
+     */
+    constexpr IndexT& Heap(int position) noexcept
+    {
+        return m_heap[static_cast<std::size_t>(position + static_cast<int>(window / 2))];
+    }
+
+    constexpr IndexT Heap(int position) const noexcept
+    {
+        return m_heap[static_cast<std::size_t>(position + static_cast<int>(window / 2))];
+    }
+
+    constexpr int MinCount() const noexcept
+    {
+        return static_cast<int>((std::min(m_count, window) - 1) / 2);
+    }
+
+    constexpr int MaxCount() const noexcept
+    {
+        return static_cast<int>(std::min(m_count, window) / 2);
+    }
+
+    constexpr bool Less(int i, int j) const noexcept
+    {
+        return m_samples[static_cast<std::size_t>(Heap(i))] < m_samples[static_cast<std::size_t>(Heap(j))];
+    }
+
+    /**
+     * @brief Swap heap positions i and j if the sample at i is smaller.
+     *
+     * @returns True if swapped.
+     */
+    constexpr bool CompareExchange(int i, int j) noexcept
+    {
+        if (!Less(i, j)) {
+            return false;
+        }
+        std::swap(Heap(i), Heap(j));
+        m_position[static_cast<std::size_t>(Heap(i))] = static_cast<IndexT>(i);
+        m_position[static_cast<std::size_t>(Heap(j))] = static_cast<IndexT>(j);
+        return true;
+    }
+
+    /**
+     * @brief Restore the min-heap below a child position.
+     */
+    constexpr void MinSortDown(int i) noexcept
+    {
+        for (; i <= MinCount(); i *= 2) {
+            if (i > 1 && i < MinCount() && Less(i + 1, i)) {
+                ++i;
+            }
+            if (!CompareExchange(i, i / 2)) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Restore the max-heap below a child position.
+     */
+    constexpr void MaxSortDown(int i) noexcept
+    {
+        for (; i >= -MaxCount(); i *= 2) {
+            if (i < -1 && i > -MaxCount() && Less(i, i - 1)) {
+                --i;
+            }
+            if (!CompareExchange(i / 2, i)) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Move a min-heap position up.
+     *
+     * @returns True if it reached the median.
+     */
+    constexpr bool MinSortUp(int i) noexcept
+    {
+        while (i > 0 && CompareExchange(i, i / 2)) {
+            i /= 2;
+        }
+        return i == 0;
+    }
+
+    /**
+     * @brief Move a max-heap position up.
+     *
+     * @returns True if it reached the median.
+     */
+    constexpr bool MaxSortUp(int i) noexcept
+    {
+        while (i < 0 && CompareExchange(i / 2, i)) {
+            i /= 2;
+        }
+        return i == 0;
+    }
+};
+
+/**
+ * @class CicDecimator, Cascaded integrator-comb decimation filter.
+ *
+ * StagesT integrators run at the input rate and StagesT combs at the output
+ * rate, giving a sinc^StagesT low-pass with a decimation by DecimationT
+ * using only additions. The integrators wrap in modular arithmetic, which
+ * the combs undo exactly, and the output is divided by the gain
+ * DecimationT^StagesT to keep the input scale.
+ *
+ * @tparam SampleT      Integer sample type (e.g., std::uint16_t for ADC readings).
+ * @tparam DecimationT  Input samples per output sample (e.g., CicDecimation<16>).
+ * @tparam StagesT      Number of stages (e.g., CicStages<3>).
+ *
+ * @note Power of two decimation ratios turn the gain division into a shift.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Filter.hpp>
+ *
+ * STM32::CicDecimator<std::uint16_t, STM32::CicDecimation<16>, STM32::CicStages<3>> cic{};
+ *
+ * // 1024 samples from a DMA block in, 64 decimated samples out
+ * std::array<std::uint16_t, 64> decimated{};
+ * auto count = cic.Update(block->Channel(0), decimated);
+ * @endcode
+ */
+template <std::integral SampleT, IsCicDecimation DecimationT, IsCicStages StagesT>
+class CicDecimator {
+    static constexpr std::size_t growth_bits{
+        StagesT::value * std::bit_width(DecimationT::value - 1)
+    };
+    static_assert(
+        std::numeric_limits<SampleT>::digits + std::is_signed_v<SampleT> + growth_bits <= 64,
+        "CIC register growth exceeds 64 bits, reduce the stages or the decimation ratio!"
+    );
+    using RegisterT = std::conditional_t<
+        (std::numeric_limits<SampleT>::digits + std::is_signed_v<SampleT> + growth_bits <= 32),
+        std::uint32_t,
+        std::uint64_t
+    >;
+    using SignedRegisterT = std::make_signed_t<RegisterT>;
+
+    static constexpr RegisterT Gain() noexcept
+    {
+        RegisterT gain{1};
+        for (std::uint32_t stage{}; stage < StagesT::value; ++stage) {
+            gain *= DecimationT::value;
+        }
+        return gain;
+    }
+public:
+
+    /**
+     * @brief Add a sample.
+     *
+     * @param sample    New sample.
+     *
+     * @returns True if a decimated output is ready (see Get()).
+     */
+    constexpr bool Update(SampleT sample) noexcept
+    {
+        RegisterT value{static_cast<RegisterT>(sample)};
+        for (auto& integrator : m_integrators) {
+            integrator += value;
+            value = integrator;
+        }
+        if (++m_phase < DecimationT::value) {
+            return false;
+        }
+        m_phase = 0;
+        for (auto& delay : m_combs) {
+            const RegisterT previous{delay};
+            delay = value;
+            value -= previous;
+        }
+        if constexpr (std::is_signed_v<SampleT>) {
+            m_output = static_cast<SampleT>(
+                static_cast<SignedRegisterT>(value) / static_cast<SignedRegisterT>(Gain())
+            );
+        } else {
+            m_output = static_cast<SampleT>(value / Gain());
+        }
+        return true;
+    }
+
+    /**
+     * @brief Add a block of samples and collect the decimated outputs.
+     *
+     * @param samples   New samples, oldest first.
+     * @param outputs   Destination of the decimated samples.
+     *
+     * @returns Number of outputs written, outputs beyond the destination size are dropped.
+     */
+    constexpr std::size_t Update(std::span<const SampleT> samples, std::span<SampleT> outputs) noexcept
+    {
+        std::size_t count{};
+        for (const auto sample : samples) {
+            if (Update(sample) && count < outputs.size()) {
+                outputs[count++] = m_output;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @returns Latest decimated output.
+     */
+    [[nodiscard]]
+    constexpr SampleT Get() const noexcept
+    {
+        return m_output;
+    }
+
+    /**
+     * @brief Clear the integrators and combs.
+     */
+    constexpr void Reset() noexcept
+    {
+        *this = CicDecimator{};
+    }
+
+private:
+    std::array<RegisterT, StagesT::value> m_integrators{};
+    std::array<RegisterT, StagesT::value> m_combs{};
+    std::uint32_t m_phase{0};
+    SampleT m_output{};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_FILTER_HPP */
@@ -4,10 +4,14 @@
 #ifndef STM32_GPIO_HPP
 #define STM32_GPIO_HPP
 
+#include <array>
+#include <bit>
 #include <concepts>
 #include <cstdint>
 #include <utility>
 
+#include "__Internal/__Utility.hpp"
+
 #include "main.h"
 
 #if !defined(HAL_GPIO_MODULE_ENABLED) /* module check */
@@ -267,6 +271,178 @@ using GpioInput = Gpio<GpioType::Input>;
  */ 
 using GpioOutput = Gpio<GpioType::Output>;
 
+/**
+ * @class GpioInterrupt, GPIO pin with an external interrupt (EXTI) callback.
+ * 
+ * The pin and its EXTI line must be configured by CubeMX (e.g., falling edge
+ * for a data-ready signal) with the EXTI interrupt enabled in NVIC. HAL
+ * reports EXTI events through a single weak callback, so the application
+ * forwards it to Dispatch() once, and each GpioInterrupt receives only the
+ * events of its own pin.
+ * 
+ * @note GpioInterrupt class is non-copyable and non-movable.
+ * @note Only one GpioInterrupt can be enabled per pin number, since pins with
+ *       the same number on different ports share an EXTI line.
+ * @note The callback is invoked in interrupt context.
+ *
+ * @example Usage:
+ * @code{.cpp}
+ * #include <STM32LibraryCollection/Gpio.hpp>
+ *
+ * extern "C" void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterrupt::Dispatch(GPIO_Pin);
+ * }
+ *
+ * STM32::GpioInterrupt drdy{GPIOB, GPIO_PIN_0};
+ * drdy.Enable([](){
+ *     // New sample ready
+ * });
+ * if (drdy.IsLow()) {
+ *     // DRDY asserted
+ * }
+ * drdy.Disable();
+ * @endcode
+ */
+class GpioInterrupt {
+public:
+
+    /**
+     * @brief Construct a new GpioInterrupt object.
+     * 
+     * @param handle        HAL GPIO handle.
+     * @param pin           GPIO pin number (single GPIO_PIN_x).
+     *
+     * @note The callback is not invoked until Enable() is called.
+     */
+    GpioInterrupt(GPIO_TypeDef* handle, std::uint16_t pin) noexcept
+        : m_handle{handle}, m_pin{pin}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    GpioInterrupt(const GpioInterrupt &) = delete;
+    GpioInterrupt &operator=(const GpioInterrupt &) = delete;
+    GpioInterrupt(GpioInterrupt &&) = delete;
+    GpioInterrupt &operator=(GpioInterrupt &&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the GpioInterrupt object, disables the callback.
+     */
+    ~GpioInterrupt()
+    {
+        Disable();
+    }
+
+    /**
+     * @returns HAL GPIO handle.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @returns GPIO pin number.
+     */
+    [[nodiscard]]
+    std::uint16_t GetPin() const noexcept
+    {
+        return m_pin;
+    }
+
+    /**
+     * @brief Enable the interrupt callback.
+     * 
+     * Pending events that occurred before this call are discarded.
+     * 
+     * @param interrupt_callback    Callback function to be called on every EXTI event of the pin.
+     */
+    void Enable(CallbackT&& interrupt_callback) noexcept
+    {
+        Disable();
+        m_callback = std::move(interrupt_callback);
+        __HAL_GPIO_EXTI_CLEAR_IT(m_pin);
+        s_callbacks[LineOf(m_pin)] = &m_callback;
+    }
+
+    /**
+     * @brief Disable the interrupt callback.
+     * 
+     * @note The EXTI line stays enabled, events are ignored.
+     */
+    void Disable() noexcept
+    {
+        if (s_callbacks[LineOf(m_pin)] == &m_callback) {
+            s_callbacks[LineOf(m_pin)] = nullptr;
+        }
+    }
+
+    /**
+     * @returns State of the GPIO pin.
+     */
+    [[nodiscard]]
+    GpioPinState Read() const noexcept
+    {
+        return static_cast<GpioPinState>(
+            HAL_GPIO_ReadPin(m_handle, m_pin)
+        );
+    }
+
+    /**
+     * @returns True if the GPIO pin is in High state.
+     */
+    [[nodiscard]]
+    bool IsHigh() const noexcept
+    {
+        return Read() == GpioPinState::High;
+    }
+
+    /**
+     * @returns True if the GPIO pin is in Low state.
+     */
+    [[nodiscard]]
+    bool IsLow() const noexcept
+    {
+        return Read() == GpioPinState::Low;
+    }
+
+    /**
+     * @brief Invoke the callback enabled for an EXTI event.
+     * 
+     * Call from HAL_GPIO_EXTI_Callback (or from both HAL_GPIO_EXTI_Rising_Callback
+     * and HAL_GPIO_EXTI_Falling_Callback on families that split them).
+     * 
+     * @param pin       GPIO pin number reported by HAL.
+     */
+    static void Dispatch(std::uint16_t pin) noexcept
+    {
+        if (auto* callback = s_callbacks[LineOf(pin)]) {
+            (*callback)();
+        }
+    }
+
+private:
+    GPIO_TypeDef* m_handle;
+    std::uint16_t m_pin;
+    CallbackT m_callback{};
+    static inline std::array<CallbackT*, 16> s_callbacks{};
+
+    /**
+     * @param pin       GPIO pin number (single GPIO_PIN_x).
+     * 
+     * @returns EXTI line index of the pin.
+     */
+    static constexpr std::size_t LineOf(std::uint16_t pin) noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(pin)) & 0x0F;
+    }
+};
+
 } /* namespace STM32 */
 
 #endif /* STM32_GPIO_HPP */
@@ -0,0 +1,391 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_HC595_HPP
+#define STM32_HC595_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "DmaBuffer.hpp"
+#include "Gpio.hpp"
+#include "Spi.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct Hc595OutputCount, A utility struct to hold the number of outputs of a 74HC595 chain.
+ *
+ * @tparam OutputCountV     Number of outputs, 8 per shift register (e.g., 64 for 8 chained registers).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hc595.hpp>
+ *
+ * using MyChain = STM32::Hc595OutputCount<64>;
+ * auto outputs = MyChain::value; // outputs is 64.
+ * @endcode
+ */
+template <std::size_t OutputCountV>
+struct Hc595OutputCount : __Internal::__Constant<std::size_t, OutputCountV> {
+    static_assert(
+        OutputCountV > 0 && OutputCountV % 8 == 0,
+        "Output count must be a non-zero multiple of 8"
+    );
+};
+
+/**
+ * @brief IsHc595OutputCount, A concept to check if a type is a Hc595OutputCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hc595.hpp>
+ *
+ * static_assert(STM32::IsHc595OutputCount<STM32::Hc595OutputCount<64>>);
+ * static_assert(!STM32::IsHc595OutputCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsHc595OutputCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0 && T::value % 8 == 0;
+
+/**
+ * @class Hc595, Output expander over a chain of 74HC595 shift registers driven by SPI DMA.
+ *
+ * Outputs are kept in a shadow bit image. Writing an output only updates the
+ * shadow and marks it dirty; Flush() copies the image to a DMA buffer and
+ * shifts it out asynchronously, then pulses the latch (RCLK) once the last bit
+ * has been clocked. Flush() does nothing when no output changed, and a flush
+ * requested while a transfer is in progress is performed right after it.
+ *
+ * Output 0 is QA of the register closest to the MCU, output 8 is QA of the
+ * next register in the chain, and so on.
+ *
+ * @tparam SpiT             Spi type (any working mode, transfers always use DMA).
+ * @tparam OutputCountT     Number of outputs (e.g., Hc595OutputCount<64>).
+ *
+ * @note Hc595 class is non-copyable and non-movable.
+ * @note SPI must be configured as master, MSB first, CPOL=0, CPHA=0.
+ * @note Outputs must be written from a single context, and Flush()/Refresh()
+ *       must be called from a single context (e.g., only the main loop or only
+ *       a PeriodicTimer callback), the two may differ.
+ * @note The latch pin must be low when idle.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hc595.hpp>
+ * #include <STM32LibraryCollection/Timer.hpp>
+ *
+ * SPI_HandleTypeDef hspi2; // Assume properly initialized with DMA by CubeMX
+ * TIM_HandleTypeDef htim6; // Assume properly initialized for 1 kHz update rate
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi2};
+ * STM32::GpioOutput latch{GPIOB, GPIO_PIN_12};
+ * STM32::Hc595<decltype(spi), STM32::Hc595OutputCount<64>> outputs{spi, latch};
+ *
+ * // 1. Per-output access like GpioOutput, updates only the shadow image
+ * outputs[3].High();
+ * outputs[42] = STM32::GpioPinState::High;
+ * outputs.Toggle(17);
+ *
+ * // 2. Push the changes, returns immediately
+ * outputs.Flush();
+ *
+ * // 3. Or flush periodically from a timer
+ * STM32::PeriodicTimer<STM32_UNIQUE_TAG> tick{htim6};
+ * tick.Start([&outputs](){
+ *     outputs.Flush();
+ * });
+ * @endcode
+ */
+template <IsSpi SpiT, IsHc595OutputCount OutputCountT>
+class Hc595 {
+    static constexpr std::size_t register_count{OutputCountT::value / 8};
+public:
+
+    /**
+     * @class Output, A single expander output with a GpioOutput-like interface.
+     *
+     * @note Output is a lightweight reference and must not outlive its Hc595.
+     */
+    class Output {
+    public:
+
+        /**
+         * @brief Construct Output class.
+         *
+         * @param expander  Reference to the owning expander.
+         * @param index     Output index.
+         */
+        Output(Hc595& expander, std::size_t index) noexcept
+          : m_expander{expander}, m_index{index}
+        { }
+
+        /**
+         * @brief Write the output state.
+         *
+         * @param pin_state     State to write to the output.
+         */
+        void Write(GpioPinState pin_state) noexcept
+        {
+            m_expander.Write(m_index, pin_state);
+        }
+
+        /**
+         * @brief Assignment operator to write the output state.
+         *
+         * @param state     State to write to the output.
+         *
+         * @returns Reference to the current Output object.
+         */
+        Output& operator=(GpioPinState state) noexcept
+        {
+            Write(state);
+            return *this;
+        }
+
+        /**
+         * @brief Set the output to High state.
+         */
+        void High() noexcept
+        {
+            Write(GpioPinState::High);
+        }
+
+        /**
+         * @brief Set the output to Low state.
+         */
+        void Low() noexcept
+        {
+            Write(GpioPinState::Low);
+        }
+
+        /**
+         * @brief Toggle the output state.
+         */
+        void Toggle() noexcept
+        {
+            m_expander.Toggle(m_index);
+        }
+
+        /**
+         * @returns State of the output in the shadow image.
+         */
+        [[nodiscard]]
+        GpioPinState Read() const noexcept
+        {
+            return m_expander.Read(m_index);
+        }
+
+    private:
+        Hc595& m_expander;
+        std::size_t m_index;
+    };
+
+    /**
+     * @brief Construct Hc595 class.
+     *
+     * @param spi       Reference to the Spi connected to SER/SRCLK.
+     * @param latch     Reference to the GPIO output connected to RCLK.
+     *
+     * @note All outputs start low, call Flush() to apply the initial state.
+     */
+    Hc595(SpiT& spi, GpioOutput& latch) noexcept
+      : m_spi{spi}, m_latch{latch}
+    {
+        m_latch.Low();
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Hc595(const Hc595&) = delete;
+    Hc595& operator=(const Hc595&) = delete;
+    Hc595(Hc595&&) = delete;
+    Hc595& operator=(Hc595&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Hc595 class.
+     */
+    ~Hc595() = default;
+
+    /**
+     * @returns Number of outputs.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Size() noexcept
+    {
+        return OutputCountT::value;
+    }
+
+    /**
+     * @brief Access an output without bounds checking.
+     *
+     * @param index     Output index.
+     *
+     * @returns Output proxy.
+     */
+    [[nodiscard]]
+    Output operator[](std::size_t index) noexcept
+    {
+        return Output{*this, index};
+    }
+
+    /**
+     * @brief Write an output state in the shadow image.
+     *
+     * @param index         Output index (unchecked).
+     * @param pin_state     State to write to the output.
+     */
+    void Write(std::size_t index, GpioPinState pin_state) noexcept
+    {
+        const auto mask = static_cast<std::uint8_t>(1U << (index % 8));
+        auto& image = m_shadow[index / 8];
+        if (pin_state == GpioPinState::High) {
+            image = static_cast<std::uint8_t>(image | mask);
+        } else {
+            image = static_cast<std::uint8_t>(image & ~mask);
+        }
+        m_dirty.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Toggle an output state in the shadow image.
+     *
+     * @param index     Output index (unchecked).
+     */
+    void Toggle(std::size_t index) noexcept
+    {
+        auto& image = m_shadow[index / 8];
+        image = static_cast<std::uint8_t>(image ^ (1U << (index % 8)));
+        m_dirty.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read an output state from the shadow image.
+     *
+     * @param index     Output index (unchecked).
+     *
+     * @returns State of the output, as last written.
+     */
+    [[nodiscard]]
+    GpioPinState Read(std::size_t index) const noexcept
+    {
+        return ((m_shadow[index / 8] >> (index % 8)) & 1U) ?
+            GpioPinState::High : GpioPinState::Low;
+    }
+
+    /**
+     * @returns True if the shadow image has changes not yet flushed.
+     */
+    [[nodiscard]]
+    bool IsDirty() const noexcept
+    {
+        return m_dirty.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns True if a transfer is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_busy.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Shift out the shadow image if it changed.
+     *
+     * If a transfer is in progress, the changes are flushed as soon as it completes.
+     *
+     * @returns True if the image is up to date or being transferred, false on SPI error.
+     */
+    bool Flush() noexcept
+    {
+        if (!IsDirty() || IsBusy()) {
+            return true;
+        }
+        return Transfer();
+    }
+
+    /**
+     * @brief Shift out the shadow image unconditionally.
+     *
+     * Useful to periodically restore outputs after electrical disturbances.
+     *
+     * @returns True if the image is being transferred, false on SPI error.
+     */
+    bool Refresh() noexcept
+    {
+        m_dirty.store(true, std::memory_order_release);
+        return Flush();
+    }
+
+private:
+    SpiT& m_spi;
+    GpioOutput& m_latch;
+    std::array<std::uint8_t, register_count> m_shadow{};
+    DmaBuffer<std::uint8_t, register_count> m_transmit_buffer{};
+    std::atomic<bool> m_dirty{false};
+    std::atomic<bool> m_busy{false};
+
+    /**
+     * @brief Copy the shadow image to the DMA buffer and start the transfer.
+     *
+     * The first byte shifted out ends up in the last register of the chain,
+     * so registers are transmitted in reverse order.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Transfer() noexcept
+    {
+        m_busy.store(true, std::memory_order_release);
+        m_dirty.store(false, std::memory_order_release);
+        for (std::size_t i = 0; i < register_count; ++i) {
+            m_transmit_buffer[register_count - 1 - i] = m_shadow[i];
+        }
+        const bool started = m_spi.template TransmitWithDiscard<WorkingMode::DMA>(
+            m_transmit_buffer,
+            [this](){
+                OnTransferComplete();
+            }
+        );
+        if (!started) {
+            m_dirty.store(true, std::memory_order_release);
+            m_busy.store(false, std::memory_order_release);
+        }
+        return started;
+    }
+
+    /**
+     * @brief Latch the shifted image and start a pending flush.
+     *
+     * A failed transfer is not latched, the image stays dirty for the next Flush().
+     */
+    void OnTransferComplete() noexcept
+    {
+        if (m_spi.HasError()) {
+            m_dirty.store(true, std::memory_order_release);
+            m_busy.store(false, std::memory_order_release);
+            return;
+        }
+        m_latch.High();
+        m_latch.Low();
+        m_busy.store(false, std::memory_order_release);
+        if (IsDirty()) {
+            Transfer();
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_HC595_HPP */
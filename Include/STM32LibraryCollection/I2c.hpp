@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "Config.hpp"
+#include "DmaBuffer.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -38,6 +39,19 @@ enum class I2cMemoryAddressSize {
     Bits16 = I2C_MEMADD_SIZE_16BIT  /**< 16-bit memory address (EEPROMs) */
 };
 
+/**
+ * @enum I2cFrame, Position of a frame in a sequential transfer.
+ * 
+ * Consecutive frames are joined with a repeated START instead of STOP/START.
+ */
+enum class I2cFrame : std::uint32_t {
+    First = I2C_FIRST_FRAME,                /**< START, no STOP at the end */
+    FirstAndNext = I2C_FIRST_AND_NEXT_FRAME,/**< START, no STOP, same direction follows */
+    Next = I2C_NEXT_FRAME,                  /**< Continuation (repeated START on direction change), no STOP */
+    Last = I2C_LAST_FRAME,                  /**< Continuation followed by STOP */
+    FirstAndLast = I2C_FIRST_AND_LAST_FRAME /**< Complete transfer, START and STOP */
+};
+
 /**
  * @struct I2cTimeout, A utility struct to hold the I2C operation timeout value.
  * 
@@ -261,6 +275,12 @@ concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
  * - Master receive (ReceiveTo)
  * - Memory/register write (MemoryWrite)
  * - Memory/register read (MemoryReadTo)
+ * - Sequential frames joined by repeated START (SequentialTransmit,
+ *   SequentialReceiveTo, TransmitThenReceiveTo)
+ * 
+ * Every operation accepts its addresses either as template parameters or as
+ * runtime arguments. Both forms share one non-template transfer core per
+ * operation and working mode, so using many addresses does not duplicate code.
  * 
  * @tparam WorkingModeT         Working mode of the I2C
  *                              (WorkingMode::Blocking, WorkingMode::Interrupt, WorkingMode::DMA).
@@ -270,6 +290,8 @@ concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
  * @note I2c class is non-copyable and non-movable.
  * @note This class operates in master mode only.
  * @note Device addresses should be 7-bit left-shifted (or 8-bit with R/W bit cleared).
+ * @note On cores with data cache, DMA receive buffers must be DmaBuffer, cache
+ *       maintenance is performed automatically on the transferred range.
  *
  * @example Usage:
  * @code {.cpp}
@@ -321,6 +343,26 @@ concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
  * if (i2c.IsDeviceReady<Mpu6050Address>()) {
  *     // Device is responding
  * }
+ *
+ * // 8. Runtime addresses (computed register/EEPROM addresses, bus scans)
+ * for (std::uint16_t reg = 0x3B; reg < 0x49; reg += 2) {
+ *     i2c.MemoryReadTo<STM32::WorkingMode::Blocking>(
+ *         0x68, reg, STM32::I2cMemoryAddressSize::Bits8, rx_data
+ *     );
+ * }
+ *
+ * // 9. Register read without STOP between the write and the read
+ * static constexpr std::array<std::uint8_t, 1> status_reg{0x0F};
+ * i2c.TransmitThenReceiveTo<Mpu6050Address>(status_reg, rx_data, [](){
+ *     // rx_data holds the register contents
+ * });
+ *
+ * // 10. Stream one read into two buffers
+ * std::array<std::uint8_t, 2> header{};
+ * std::array<std::uint8_t, 64> payload{};
+ * i2c.SequentialReceiveTo<Mpu6050Address>(header, STM32::I2cFrame::First, [&](){
+ *     i2c.SequentialReceiveTo<Mpu6050Address>(payload, STM32::I2cFrame::Last);
+ * });
  * @endcode
  */
 template <IsWorkingMode WorkingModeT, __Internal::__IsUniqueTag UniqueTagT>
@@ -341,6 +383,14 @@ class I2c {
         I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
         HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MEM_RX_COMPLETE_CB_ID
     >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_ERROR_CB_ID
+    >;
+    using AbortCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_ABORT_CB_ID
+    >;
 public:
 
     /**
@@ -355,8 +405,17 @@ public:
         m_master_transmit_complete_callback{handle},
         m_master_receive_complete_callback{handle},
         m_memory_transmit_complete_callback{handle},
-        m_memory_receive_complete_callback{handle}
-    { }
+        m_memory_receive_complete_callback{handle},
+        m_error_callback{handle},
+        m_abort_callback{handle}
+    {
+        m_error_callback.Set([this](){
+            OnError();
+        });
+        m_abort_callback.Set([this](){
+            OnError();
+        });
+    }
 
     /**
      * @defgroup Deleted copy and move members.
@@ -384,6 +443,21 @@ public:
         return std::forward<decltype(self)>(self).m_handle;
     }
 
+    /**
+     * @brief Set the callback called when a non-blocking transfer without its own error callback fails.
+     * 
+     * A failed transfer (e.g., NACK or arbitration loss) does not invoke its
+     * complete callback. The error callback passed with the transfer is
+     * invoked instead, or this one if none was passed. Drivers sharing a bus
+     * pass their own error callbacks, so this one is left to the application.
+     * 
+     * @param error_callback    Callback function to be called upon error.
+     */
+    void SetErrorCallback(CallbackT&& error_callback) noexcept
+    {
+        m_default_error_callback = std::move(error_callback);
+    }
+
     /* ==================== Master Receive Operations ==================== */
 
     /**
@@ -409,13 +483,9 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Master_Receive(
-            &m_handle,
-            DeviceAddressT::value,
-            std::ranges::data(rx_message),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
-            TimeoutV::value
-        ));
+        return ReceiveTo<RxWorkingModeT, TimeoutV>(
+            DeviceAddressT::value >> 1, rx_message
+        );
     }
 
     /**
@@ -426,6 +496,7 @@ public:
      * 
      * @param rx_message        A contiguous range to store the received data.
      * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
      * 
      * @returns True on success, false otherwise.
      * 
@@ -437,27 +508,104 @@ public:
     >
     bool ReceiveTo(
         IsI2cMessage auto& rx_message,
-        CallbackT&& complete_callback = [](){}
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
     ) noexcept
     requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
     {
-        m_master_receive_complete_callback.Set(
-            std::move(complete_callback)
+        return ReceiveTo<RxWorkingModeT>(
+            DeviceAddressT::value >> 1, rx_message, std::move(complete_callback), std::move(error_callback)
+        );
+    }
+
+    /**
+     * @brief Receive data from a slave device at a runtime address in blocking mode.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * @tparam TimeoutV         Timeout for blocking mode (default is 100ms).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param rx_message        A contiguous range to store the received data.
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     *
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT,
+        IsI2cTimeout TimeoutV = I2cTimeout<100>
+    >
+    bool ReceiveTo(
+        std::uint16_t device_address,
+        IsI2cMessage auto& rx_message
+    ) noexcept
+    requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        return MasterReceiveCore(
+            WorkingMode::Blocking{},
+            static_cast<std::uint16_t>(device_address << 1),
+            std::ranges::data(rx_message),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            TimeoutV::value
+        );
+    }
+
+    /**
+     * @brief Receive data from a slave device at a runtime address in non-blocking mode.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool ReceiveTo(
+        std::uint16_t device_address,
+        IsI2cMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(rx_message)
         );
         if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Master_Receive_IT(
-                &m_handle,
-                DeviceAddressT::value,
+            return MasterReceiveCore(
+                WorkingMode::Interrupt{},
+                static_cast<std::uint16_t>(device_address << 1),
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size,
+                std::move(complete_callback)
+            );
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Master_Receive_DMA(
-                &m_handle,
-                DeviceAddressT::value,
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            return MasterReceiveCore(
+                WorkingMode::DMA{},
+                static_cast<std::uint16_t>(device_address << 1),
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size,
+                std::move(complete_callback),
+                *invalidate_region
+            );
         }
     }
 
@@ -486,13 +634,9 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Master_Transmit(
-            &m_handle,
-            DeviceAddressT::value,
-            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
-            TimeoutV::value
-        ));
+        return Transmit<TxWorkingModeT, TimeoutV>(
+            DeviceAddressT::value >> 1, tx_message
+        );
     }
 
     /**
@@ -503,6 +647,7 @@ public:
      * 
      * @param tx_message         A contiguous range containing the data to transmit.
      * @param complete_callback  Callback function to be called upon completion.
+     * @param error_callback     Callback function to be called upon failure (null uses the SetErrorCallback one).
      * 
      * @returns True on success, false otherwise.
      * 
@@ -514,28 +659,93 @@ public:
     >
     bool Transmit(
         const IsI2cMessage auto& tx_message,
-        CallbackT&& complete_callback = [](){}
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
     ) noexcept
     requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
     {
-        m_master_transmit_complete_callback.Set(
-            std::move(complete_callback)
+        return Transmit<TxWorkingModeT>(
+            DeviceAddressT::value >> 1, tx_message, std::move(complete_callback), std::move(error_callback)
         );
-        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Master_Transmit_IT(
-                &m_handle,
-                DeviceAddressT::value,
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
-        } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Master_Transmit_DMA(
-                &m_handle,
-                DeviceAddressT::value,
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+    }
+
+    /**
+     * @brief Transmit data to a slave device at a runtime address in blocking mode.
+     * 
+     * @tparam TxWorkingModeT   Working mode for transmitting (default is WorkingModeT).
+     * @tparam TimeoutV         Timeout for blocking mode (default is 100ms).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT,
+        IsI2cTimeout TimeoutV = I2cTimeout<100>
+    >
+    bool Transmit(
+        std::uint16_t device_address,
+        const IsI2cMessage auto& tx_message
+    ) noexcept
+    requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        return MasterTransmitCore(
+            WorkingMode::Blocking{},
+            static_cast<std::uint16_t>(device_address << 1),
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            TimeoutV::value
+        );
+    }
+
+    /**
+     * @brief Transmit data to a slave device at a runtime address in non-blocking mode.
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param device_address     7-bit I2C device address (0x00-0x7F).
+     * @param tx_message         A contiguous range containing the data to transmit.
+     * @param complete_callback  Callback function to be called upon completion.
+     * @param error_callback     Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool Transmit(
+        std::uint16_t device_address,
+        const IsI2cMessage auto& tx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(tx_message)
+        );
+        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+            __Internal::__PrepareDmaTransmit(tx_message, size);
         }
+        return MasterTransmitCore(
+            TxWorkingModeT{},
+            static_cast<std::uint16_t>(device_address << 1),
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            size,
+            std::move(complete_callback)
+        );
     }
 
     /* ==================== Memory Read Operations ==================== */
@@ -565,15 +775,12 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Mem_Read(
-            &m_handle,
-            DeviceAddressT::value,
+        return MemoryReadTo<RxWorkingModeT, TimeoutV>(
+            DeviceAddressT::value >> 1,
             MemoryAddressT::address,
-            std::to_underlying(MemoryAddressT::address_size),
-            std::ranges::data(rx_message),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
-            TimeoutV::value
-        ));
+            MemoryAddressT::address_size,
+            rx_message
+        );
     }
 
     /**
@@ -585,6 +792,7 @@ public:
      * 
      * @param rx_message        A contiguous range to store the received data.
      * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
      * 
      * @returns True on success, false otherwise.
      * 
@@ -597,31 +805,125 @@ public:
     >
     bool MemoryReadTo(
         IsI2cMessage auto& rx_message,
-        CallbackT&& complete_callback = [](){}
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
     ) noexcept
     requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
     {
-        m_memory_receive_complete_callback.Set(
-            std::move(complete_callback)
+        return MemoryReadTo<RxWorkingModeT>(
+            DeviceAddressT::value >> 1,
+            MemoryAddressT::address,
+            MemoryAddressT::address_size,
+            rx_message,
+            std::move(complete_callback),
+            std::move(error_callback)
+        );
+    }
+
+    /**
+     * @brief Read data from a runtime memory/register address on a slave device in blocking mode.
+     * 
+     * @tparam RxWorkingModeT       Working mode for reading (default is WorkingModeT).
+     * @tparam TimeoutV             Timeout for blocking mode (default is 100ms).
+     * 
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param rx_message            A contiguous range to store the received data.
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     *
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT,
+        IsI2cTimeout TimeoutV = I2cTimeout<100>
+    >
+    bool MemoryReadTo(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        IsI2cMessage auto& rx_message
+    ) noexcept
+    requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
+    {
+        if (!IsValidDeviceAddress(device_address) ||
+            !IsValidMemoryAddress(memory_address, memory_address_size)) {
+            return false;
+        }
+        return MemoryReadCore(
+            WorkingMode::Blocking{},
+            static_cast<std::uint16_t>(device_address << 1),
+            memory_address,
+            memory_address_size,
+            std::ranges::data(rx_message),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            TimeoutV::value
+        );
+    }
+
+    /**
+     * @brief Read data from a runtime memory/register address on a slave device in non-blocking mode.
+     * 
+     * @tparam RxWorkingModeT       Working mode for reading (default is WorkingModeT).
+     * 
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param rx_message            A contiguous range to store the received data.
+     * @param complete_callback     Callback function to be called upon completion.
+     * @param error_callback        Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool MemoryReadTo(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        IsI2cMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address) ||
+            !IsValidMemoryAddress(memory_address, memory_address_size)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(rx_message)
         );
         if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Mem_Read_IT(
-                &m_handle,
-                DeviceAddressT::value,
-                MemoryAddressT::address,
-                std::to_underlying(MemoryAddressT::address_size),
+            return MemoryReadCore(
+                WorkingMode::Interrupt{},
+                static_cast<std::uint16_t>(device_address << 1),
+                memory_address,
+                memory_address_size,
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size,
+                std::move(complete_callback)
+            );
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Mem_Read_DMA(
-                &m_handle,
-                DeviceAddressT::value,
-                MemoryAddressT::address,
-                std::to_underlying(MemoryAddressT::address_size),
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            return MemoryReadCore(
+                WorkingMode::DMA{},
+                static_cast<std::uint16_t>(device_address << 1),
+                memory_address,
+                memory_address_size,
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size,
+                std::move(complete_callback),
+                *invalidate_region
+            );
         }
     }
 
@@ -652,15 +954,12 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Mem_Write(
-            &m_handle,
-            DeviceAddressT::value,
+        return MemoryWrite<TxWorkingModeT, TimeoutV>(
+            DeviceAddressT::value >> 1,
             MemoryAddressT::address,
-            std::to_underlying(MemoryAddressT::address_size),
-            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
-            TimeoutV::value
-        ));
+            MemoryAddressT::address_size,
+            tx_message
+        );
     }
 
     /**
@@ -672,6 +971,7 @@ public:
      * 
      * @param tx_message         A contiguous range containing the data to write.
      * @param complete_callback  Callback function to be called upon completion.
+     * @param error_callback     Callback function to be called upon failure (null uses the SetErrorCallback one).
      * 
      * @returns True on success, false otherwise.
      * 
@@ -684,69 +984,845 @@ public:
     >
     bool MemoryWrite(
         const IsI2cMessage auto& tx_message,
-        CallbackT&& complete_callback = [](){}
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
     ) noexcept
     requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
     {
-        m_memory_transmit_complete_callback.Set(
-            std::move(complete_callback)
+        return MemoryWrite<TxWorkingModeT>(
+            DeviceAddressT::value >> 1,
+            MemoryAddressT::address,
+            MemoryAddressT::address_size,
+            tx_message,
+            std::move(complete_callback),
+            std::move(error_callback)
         );
-        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Mem_Write_IT(
-                &m_handle,
-                DeviceAddressT::value,
-                MemoryAddressT::address,
-                std::to_underlying(MemoryAddressT::address_size),
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
-        } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Mem_Write_DMA(
-                &m_handle,
-                DeviceAddressT::value,
-                MemoryAddressT::address,
-                std::to_underlying(MemoryAddressT::address_size),
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
-        }
     }
 
-    /* ==================== Utility Operations ==================== */
-
     /**
-     * @brief Check if a device is ready on the I2C bus.
+     * @brief Write data to a runtime memory/register address on a slave device in blocking mode.
      * 
-     * @tparam DeviceAddressT   I2C device address (must satisfy IsI2cDeviceAddress).
-     * @tparam TimeoutT         Timeout for each attempt (default is 100ms).
-     * @tparam MaxAttemptsT     Maximum number of attempts (default is 3).
+     * @tparam TxWorkingModeT       Working mode for writing (default is WorkingModeT).
+     * @tparam TimeoutV             Timeout for blocking mode (default is 100ms).
      * 
-     * @returns True if device is ready (ACK received), false otherwise.
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param tx_message            A contiguous range containing the data to write.
      * 
-     * @note This function can be used to scan the I2C bus for connected devices.
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
      */
     template <
-        IsI2cDeviceAddress DeviceAddressT,
-        IsI2cTimeout TimeoutT = I2cTimeout<100>,
-        IsI2cMaxAttempts MaxAttemptsT = I2cMaxAttempts<3>
+        IsWorkingMode TxWorkingModeT = WorkingModeT,
+        IsI2cTimeout TimeoutV = I2cTimeout<100>
     >
-    [[nodiscard]]
-    bool IsDeviceReady() noexcept
+    bool MemoryWrite(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        const IsI2cMessage auto& tx_message
+    ) noexcept
+    requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_IsDeviceReady(
-            &m_handle,
-            DeviceAddressT::value,
-            MaxAttemptsT::value,
-            TimeoutT::value
-        ));
+        if (!IsValidDeviceAddress(device_address) ||
+            !IsValidMemoryAddress(memory_address, memory_address_size)) {
+            return false;
+        }
+        return MemoryWriteCore(
+            WorkingMode::Blocking{},
+            static_cast<std::uint16_t>(device_address << 1),
+            memory_address,
+            memory_address_size,
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            TimeoutV::value
+        );
     }
 
-private:
-    I2C_HandleTypeDef& m_handle;
-    MasterTransmitCompleteCallbackT m_master_transmit_complete_callback;
-    MasterReceiveCompleteCallbackT m_master_receive_complete_callback;
-    MemoryTransmitCompleteCallbackT m_memory_transmit_complete_callback;
-    MemoryReceiveCompleteCallbackT m_memory_receive_complete_callback;
+    /**
+     * @brief Write data to a runtime memory/register address on a slave device in non-blocking mode.
+     * 
+     * @tparam TxWorkingModeT       Working mode for writing (default is WorkingModeT).
+     * 
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param tx_message            A contiguous range containing the data to write.
+     * @param complete_callback     Callback function to be called upon completion.
+     * @param error_callback        Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool MemoryWrite(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        const IsI2cMessage auto& tx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address) ||
+            !IsValidMemoryAddress(memory_address, memory_address_size)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(tx_message)
+        );
+        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+            __Internal::__PrepareDmaTransmit(tx_message, size);
+        }
+        return MemoryWriteCore(
+            TxWorkingModeT{},
+            static_cast<std::uint16_t>(device_address << 1),
+            memory_address,
+            memory_address_size,
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            size,
+            std::move(complete_callback)
+        );
+    }
+
+    /* ==================== Sequential Operations ==================== */
+
+    /**
+     * @brief Transmit one frame of a sequential transfer to a slave device.
+     * 
+     * @tparam DeviceAddressT   I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam TxWorkingModeT   Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param frame             Position of the frame in the sequence.
+     * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsI2cDeviceAddress DeviceAddressT,
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool SequentialTransmit(
+        const IsI2cMessage auto& tx_message,
+        I2cFrame frame,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        return SequentialTransmit<TxWorkingModeT>(
+            DeviceAddressT::value >> 1, tx_message, frame, std::move(complete_callback), std::move(error_callback)
+        );
+    }
+
+    /**
+     * @brief Transmit one frame of a sequential transfer to a slave device at a runtime address.
+     * 
+     * @tparam TxWorkingModeT   Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param frame             Position of the frame in the sequence.
+     * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool SequentialTransmit(
+        std::uint16_t device_address,
+        const IsI2cMessage auto& tx_message,
+        I2cFrame frame,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(tx_message)
+        );
+        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+            __Internal::__PrepareDmaTransmit(tx_message, size);
+        }
+        return SequentialTransmitCore(
+            TxWorkingModeT{},
+            static_cast<std::uint16_t>(device_address << 1),
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            size,
+            frame,
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Receive one frame of a sequential transfer from a slave device.
+     * 
+     * @tparam DeviceAddressT   I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param rx_message        A contiguous range to store the received data.
+     * @param frame             Position of the frame in the sequence.
+     * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsI2cDeviceAddress DeviceAddressT,
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool SequentialReceiveTo(
+        IsI2cMessage auto& rx_message,
+        I2cFrame frame,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        return SequentialReceiveTo<RxWorkingModeT>(
+            DeviceAddressT::value >> 1, rx_message, frame, std::move(complete_callback), std::move(error_callback)
+        );
+    }
+
+    /**
+     * @brief Receive one frame of a sequential transfer from a slave device at a runtime address.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param rx_message        A contiguous range to store the received data.
+     * @param frame             Position of the frame in the sequence.
+     * @param complete_callback Callback function to be called upon completion.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool SequentialReceiveTo(
+        std::uint16_t device_address,
+        IsI2cMessage auto& rx_message,
+        I2cFrame frame,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        m_transfer_error_callback = std::move(error_callback);
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(rx_message)
+        );
+        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
+            return SequentialReceiveCore(
+                WorkingMode::Interrupt{},
+                static_cast<std::uint16_t>(device_address << 1),
+                std::ranges::data(rx_message),
+                size,
+                frame,
+                std::move(complete_callback)
+            );
+        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            return SequentialReceiveCore(
+                WorkingMode::DMA{},
+                static_cast<std::uint16_t>(device_address << 1),
+                std::ranges::data(rx_message),
+                size,
+                frame,
+                std::move(complete_callback),
+                *invalidate_region
+            );
+        }
+    }
+
+    /**
+     * @brief Transmit data then receive data joined by a repeated START.
+     * 
+     * @tparam DeviceAddressT   I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam WorkingModeOpT   Working mode for the transfer (default is WorkingModeT).
+     * 
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called once the receive completes.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsI2cDeviceAddress DeviceAddressT,
+        IsWorkingMode WorkingModeOpT = WorkingModeT
+    >
+    bool TransmitThenReceiveTo(
+        const IsI2cMessage auto& tx_message,
+        IsI2cMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<WorkingModeOpT, WorkingMode::Blocking>)
+    {
+        return TransmitThenReceiveTo<WorkingModeOpT>(
+            DeviceAddressT::value >> 1, tx_message, rx_message, std::move(complete_callback), std::move(error_callback)
+        );
+    }
+
+    /**
+     * @brief Transmit data then receive data joined by a repeated START, at a runtime address.
+     * 
+     * The receive frame is started from the transmit complete callback. If it
+     * cannot be started, the transfer is aborted (STOP) and the error callback
+     * is invoked.
+     * 
+     * @tparam WorkingModeOpT   Working mode for the transfer (default is WorkingModeT).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called once the receive completes.
+     * @param error_callback    Callback function to be called upon failure (null uses the SetErrorCallback one).
+     * 
+     * @returns True on success, false otherwise (including an invalid address).
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode WorkingModeOpT = WorkingModeT
+    >
+    bool TransmitThenReceiveTo(
+        std::uint16_t device_address,
+        const IsI2cMessage auto& tx_message,
+        IsI2cMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){},
+        CallbackT&& error_callback = nullptr
+    ) noexcept
+    requires (!std::same_as<WorkingModeOpT, WorkingMode::Blocking>)
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        const auto address = static_cast<std::uint16_t>(device_address << 1);
+        const auto tx_size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(tx_message)
+        );
+        const auto rx_size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(rx_message)
+        );
+        auto* const rx_data = std::ranges::data(rx_message);
+        m_sequence_callback = std::move(complete_callback);
+        m_transfer_error_callback = std::move(error_callback);
+        if constexpr (std::same_as<WorkingModeOpT, WorkingMode::Interrupt>) {
+            return SequentialTransmitCore(
+                WorkingMode::Interrupt{},
+                address,
+                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+                tx_size,
+                I2cFrame::First,
+                [this, address, rx_data, rx_size](){
+                    ReceiveSequenceTail(WorkingMode::Interrupt{}, address, rx_data, rx_size);
+                }
+            );
+        } else if constexpr (std::same_as<WorkingModeOpT, WorkingMode::DMA>) {
+            __Internal::__PrepareDmaTransmit(tx_message, tx_size);
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, rx_size);
+            if (!invalidate_region) {
+                return false;
+            }
+            return SequentialTransmitCore(
+                WorkingMode::DMA{},
+                address,
+                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+                tx_size,
+                I2cFrame::First,
+                [this, address, rx_data, rx_size, region = *invalidate_region](){
+                    ReceiveSequenceTail(WorkingMode::DMA{}, address, rx_data, rx_size, region);
+                }
+            );
+        }
+    }
+
+    /* ==================== Utility Operations ==================== */
+
+    /**
+     * @brief Check if a device is ready on the I2C bus.
+     * 
+     * @tparam DeviceAddressT   I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam TimeoutT         Timeout for each attempt (default is 100ms).
+     * @tparam MaxAttemptsT     Maximum number of attempts (default is 3).
+     * 
+     * @returns True if device is ready (ACK received), false otherwise.
+     * 
+     * @note This function can be used to scan the I2C bus for connected devices.
+     */
+    template <
+        IsI2cDeviceAddress DeviceAddressT,
+        IsI2cTimeout TimeoutT = I2cTimeout<100>,
+        IsI2cMaxAttempts MaxAttemptsT = I2cMaxAttempts<3>
+    >
+    [[nodiscard]]
+    bool IsDeviceReady() noexcept
+    {
+        return IsDeviceReady<TimeoutT, MaxAttemptsT>(DeviceAddressT::value >> 1);
+    }
+
+    /**
+     * @brief Check if a device at a runtime address is ready on the I2C bus.
+     * 
+     * @tparam TimeoutT         Timeout for each attempt (default is 100ms).
+     * @tparam MaxAttemptsT     Maximum number of attempts (default is 3).
+     * 
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * 
+     * @returns True if device is ready (ACK received), false otherwise (including an invalid address).
+     * 
+     * @note This function can be used to scan the I2C bus for connected devices.
+     */
+    template <
+        IsI2cTimeout TimeoutT = I2cTimeout<100>,
+        IsI2cMaxAttempts MaxAttemptsT = I2cMaxAttempts<3>
+    >
+    [[nodiscard]]
+    bool IsDeviceReady(std::uint16_t device_address) noexcept
+    {
+        if (!IsValidDeviceAddress(device_address)) {
+            return false;
+        }
+        return (HAL_OK == HAL_I2C_IsDeviceReady(
+            &m_handle,
+            static_cast<std::uint16_t>(device_address << 1),
+            MaxAttemptsT::value,
+            TimeoutT::value
+        ));
+    }
+
+private:
+    I2C_HandleTypeDef& m_handle;
+    MasterTransmitCompleteCallbackT m_master_transmit_complete_callback;
+    MasterReceiveCompleteCallbackT m_master_receive_complete_callback;
+    MemoryTransmitCompleteCallbackT m_memory_transmit_complete_callback;
+    MemoryReceiveCompleteCallbackT m_memory_receive_complete_callback;
+    ErrorCallbackT m_error_callback;
+    AbortCallbackT m_abort_callback;
+    CallbackT m_default_error_callback{};
+    CallbackT m_transfer_error_callback{};
+    CallbackT m_sequence_callback{};
+
+    /**
+     * @param device_address    7-bit I2C device address.
+     * 
+     * @returns True if the address fits in 7 bits, false otherwise.
+     */
+    static constexpr bool IsValidDeviceAddress(std::uint16_t device_address) noexcept
+    {
+        return device_address <= 0x7F;
+    }
+
+    /**
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * 
+     * @returns True if the address fits in the address size, false otherwise.
+     */
+    static constexpr bool IsValidMemoryAddress(
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size
+    ) noexcept
+    {
+        return memory_address_size == I2cMemoryAddressSize::Bits16 || memory_address <= 0xFF;
+    }
+
+    /**
+     * @defgroup Non-template transfer cores, one per working mode.
+     * 
+     * All public operations reduce to these functions, so each operation and
+     * working mode is instantiated once per I2c instance regardless of the
+     * number of addresses and buffer types used.
+     * 
+     * @param device_address        Left-shifted I2C device address.
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param data                  Transfer buffer.
+     * @param frame                 Position of the frame in a sequential transfer.
+     * @param size                  Transfer size in bytes.
+     * @param timeout               Timeout for blocking mode in milliseconds.
+     * @param complete_callback     Callback function to be called upon completion.
+     * @param invalidate_region     DMA receive region to invalidate upon completion.
+     * 
+     * @returns True on success, false otherwise.
+     * @{
+     */
+    bool MasterReceiveCore(
+        WorkingMode::Blocking,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        std::uint32_t timeout
+    ) noexcept
+    {
+        return (HAL_OK == HAL_I2C_Master_Receive(&m_handle, device_address, data, size, timeout));
+    }
+
+    bool MasterReceiveCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Receive_IT(&m_handle, device_address, data, size));
+    }
+
+    bool MasterReceiveCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback,
+        __Internal::__DCacheRegion invalidate_region
+    ) noexcept
+    {
+        m_master_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        m_master_receive_complete_callback.SetInvalidateRegion(invalidate_region);
+        return (HAL_OK == HAL_I2C_Master_Receive_DMA(&m_handle, device_address, data, size));
+    }
+
+    bool MasterTransmitCore(
+        WorkingMode::Blocking,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        std::uint32_t timeout
+    ) noexcept
+    {
+        return (HAL_OK == HAL_I2C_Master_Transmit(&m_handle, device_address, data, size, timeout));
+    }
+
+    bool MasterTransmitCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Transmit_IT(&m_handle, device_address, data, size));
+    }
+
+    bool MasterTransmitCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Transmit_DMA(&m_handle, device_address, data, size));
+    }
+
+    bool MemoryReadCore(
+        WorkingMode::Blocking,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        std::uint32_t timeout
+    ) noexcept
+    {
+        return (HAL_OK == HAL_I2C_Mem_Read(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size, timeout
+        ));
+    }
+
+    bool MemoryReadCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_memory_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Mem_Read_IT(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size
+        ));
+    }
+
+    bool MemoryReadCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback,
+        __Internal::__DCacheRegion invalidate_region
+    ) noexcept
+    {
+        m_memory_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        m_memory_receive_complete_callback.SetInvalidateRegion(invalidate_region);
+        return (HAL_OK == HAL_I2C_Mem_Read_DMA(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size
+        ));
+    }
+
+    bool MemoryWriteCore(
+        WorkingMode::Blocking,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        std::uint32_t timeout
+    ) noexcept
+    {
+        return (HAL_OK == HAL_I2C_Mem_Write(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size, timeout
+        ));
+    }
+
+    bool MemoryWriteCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_memory_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Mem_Write_IT(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size
+        ));
+    }
+
+    bool MemoryWriteCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::uint8_t* data,
+        std::uint16_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_memory_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Mem_Write_DMA(
+            &m_handle, device_address, memory_address,
+            std::to_underlying(memory_address_size), data, size
+        ));
+    }
+
+    bool SequentialTransmitCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        I2cFrame frame,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Seq_Transmit_IT(
+            &m_handle, device_address, data, size, std::to_underlying(frame)
+        ));
+    }
+
+    bool SequentialTransmitCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        I2cFrame frame,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Seq_Transmit_DMA(
+            &m_handle, device_address, data, size, std::to_underlying(frame)
+        ));
+    }
+
+    bool SequentialReceiveCore(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        I2cFrame frame,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_master_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return (HAL_OK == HAL_I2C_Master_Seq_Receive_IT(
+            &m_handle, device_address, data, size, std::to_underlying(frame)
+        ));
+    }
+
+    bool SequentialReceiveCore(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        I2cFrame frame,
+        CallbackT&& complete_callback,
+        __Internal::__DCacheRegion invalidate_region
+    ) noexcept
+    {
+        m_master_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        m_master_receive_complete_callback.SetInvalidateRegion(invalidate_region);
+        return (HAL_OK == HAL_I2C_Master_Seq_Receive_DMA(
+            &m_handle, device_address, data, size, std::to_underlying(frame)
+        ));
+    }
+    /** @} */
+
+    /**
+     * @defgroup Receive phase of TransmitThenReceiveTo, called from the transmit complete callback.
+     * 
+     * Hands the stored complete callback to the receive frame. If the frame
+     * cannot be started, the transfer is aborted to release the bus held by
+     * the open first frame, and the error is reported once the abort completes.
+     * @{
+     */
+    void ReceiveSequenceTail(
+        WorkingMode::Interrupt,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size
+    ) noexcept
+    {
+        if (!SequentialReceiveCore(
+                WorkingMode::Interrupt{}, device_address, data, size,
+                I2cFrame::Last, std::move(m_sequence_callback))) {
+            AbortSequence(device_address);
+        }
+    }
+
+    void ReceiveSequenceTail(
+        WorkingMode::DMA,
+        std::uint16_t device_address,
+        std::uint8_t* data,
+        std::uint16_t size,
+        __Internal::__DCacheRegion invalidate_region
+    ) noexcept
+    {
+        if (!SequentialReceiveCore(
+                WorkingMode::DMA{}, device_address, data, size,
+                I2cFrame::Last, std::move(m_sequence_callback), invalidate_region)) {
+            AbortSequence(device_address);
+        }
+    }
+
+    void AbortSequence(std::uint16_t device_address) noexcept
+    {
+        if (HAL_OK != HAL_I2C_Master_Abort_IT(&m_handle, device_address)) {
+            OnError();
+        }
+    }
+    /** @} */
+
+    /**
+     * @brief Report a failed transfer to its own error callback, or to the default one.
+     * 
+     * The transfer error callback is moved out first, it may start the next
+     * transfer and replace itself.
+     */
+    void OnError() noexcept
+    {
+        if (m_transfer_error_callback) {
+            const auto error_callback = std::move(m_transfer_error_callback);
+            error_callback();
+        } else if (m_default_error_callback) {
+            m_default_error_callback();
+        }
+    }
+};
+
+/**
+ * @brief IsI2c, A concept to check if a type is an I2c.
+ * 
+ * Used by device drivers built on top of I2c.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2c.hpp>
+ * 
+ * using MyI2c = STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG>;
+ * static_assert(STM32::IsI2c<MyI2c>);
+ * static_assert(!STM32::IsI2c<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2c = requires(T& i2c) {
+    { i2c.GetHandle() } -> std::same_as<I2C_HandleTypeDef&>;
 };
 
 } /* namespace STM32 */
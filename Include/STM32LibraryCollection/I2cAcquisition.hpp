@@ -0,0 +1,350 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_I2C_ACQUISITION_HPP
+#define STM32_I2C_ACQUISITION_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "DmaBuffer.hpp"
+#include "I2c.hpp"
+#include "Timer.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct I2cAcquisitionSampleSize, A utility struct to hold the number of bytes read per sample.
+ *
+ * @tparam SampleSizeV  Size of the register block read on every trigger (e.g., 14 for MPU-6050).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cAcquisition.hpp>
+ *
+ * using Mpu6050Block = STM32::I2cAcquisitionSampleSize<14>;
+ * auto size = Mpu6050Block::value; // size is 14.
+ * @endcode
+ */
+template <std::size_t SampleSizeV>
+struct I2cAcquisitionSampleSize : __Internal::__Constant<std::size_t, SampleSizeV> {
+    static_assert(
+        SampleSizeV > 0 && SampleSizeV <= 65535,
+        "Sample size must be between 1 and 65535 bytes"
+    );
+};
+
+/**
+ * @brief IsI2cAcquisitionSampleSize, A concept to check if a type is an I2cAcquisitionSampleSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cAcquisition.hpp>
+ *
+ * static_assert(STM32::IsI2cAcquisitionSampleSize<STM32::I2cAcquisitionSampleSize<14>>);
+ * static_assert(!STM32::IsI2cAcquisitionSampleSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cAcquisitionSampleSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0 && T::value <= 65535;
+
+/**
+ * @struct I2cAcquisitionRingSize, A utility struct to hold the number of buffered samples.
+ *
+ * @tparam RingSizeV    Samples buffered for the application (a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cAcquisition.hpp>
+ *
+ * using MyRing = STM32::I2cAcquisitionRingSize<32>;
+ * auto size = MyRing::value; // size is 32.
+ * @endcode
+ */
+template <std::size_t RingSizeV>
+struct I2cAcquisitionRingSize : __Internal::__Constant<std::size_t, RingSizeV> {
+    static_assert(
+        std::has_single_bit(RingSizeV),
+        "Ring size must be a power of two"
+    );
+};
+
+/**
+ * @brief IsI2cAcquisitionRingSize, A concept to check if a type is an I2cAcquisitionRingSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cAcquisition.hpp>
+ *
+ * static_assert(STM32::IsI2cAcquisitionRingSize<STM32::I2cAcquisitionRingSize<32>>);
+ * static_assert(!STM32::IsI2cAcquisitionRingSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cAcquisitionRingSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+/**
+ * @struct I2cSample, A register block read at one trigger.
+ *
+ * @tparam SampleSizeT  Size of the register block.
+ */
+template <IsI2cAcquisitionSampleSize SampleSizeT>
+struct I2cSample {
+    std::array<std::uint8_t, SampleSizeT::value> data{};   /**< Register block as read from the device */
+    std::uint32_t timestamp{};                              /**< Timestamp timer count at the trigger */
+};
+
+/**
+ * @class I2cAcquisition, Timer-triggered periodic burst reads of a register block.
+ *
+ * Every update event of the trigger timer stamps the time and starts a DMA
+ * memory read of the configured register block. Completed samples are pushed
+ * into a lock-free ring that the application drains with Pop(), so sampling
+ * is paced by hardware instead of the main loop.
+ *
+ * @tparam I2cT             I2c type.
+ * @tparam PeriodicTimerT   PeriodicTimer type pacing the reads.
+ * @tparam SampleSizeT      Size of the register block (e.g., I2cAcquisitionSampleSize<14>).
+ * @tparam RingSizeT        Number of buffered samples (default is 16).
+ *
+ * @note I2cAcquisition class is non-copyable and non-movable.
+ * @note Reads carry their own error callback, the I2c error callback is left
+ *       untouched. The acquisition uses the bus exclusively while running.
+ * @note A trigger arriving while the previous read is still in progress is
+ *       skipped and counted (GetOverrunCount()); a sample arriving while the
+ *       ring is full is dropped and counted (GetDroppedCount()).
+ * @note Pop() must be called from a single context.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cAcquisition.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized with DMA by CubeMX
+ * TIM_HandleTypeDef htim2; // Assume free-running at 1 MHz
+ * TIM_HandleTypeDef htim6; // Assume properly initialized for 1 kHz update rate
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::Timer clock{htim2};
+ * STM32::PeriodicTimer<STM32_UNIQUE_TAG> trigger{htim6};
+ *
+ * // MPU-6050: 14 bytes from ACCEL_XOUT_H (0x3B) every 1 ms
+ * STM32::I2cAcquisition<
+ *     decltype(i2c), decltype(trigger), STM32::I2cAcquisitionSampleSize<14>
+ * > imu{i2c, trigger, clock, 0x68, 0x3B};
+ *
+ * imu.Start();
+ *
+ * while (true) {
+ *     decltype(imu)::SampleT sample{};
+ *     while (imu.Pop(sample)) {
+ *         // sample.data holds the registers, sample.timestamp the trigger time in us
+ *     }
+ * }
+ * @endcode
+ */
+template <
+    IsI2c I2cT,
+    IsPeriodicTimer PeriodicTimerT,
+    IsI2cAcquisitionSampleSize SampleSizeT,
+    IsI2cAcquisitionRingSize RingSizeT = I2cAcquisitionRingSize<16>
+>
+class I2cAcquisition {
+public:
+    using SampleT = I2cSample<SampleSizeT>;
+
+    /**
+     * @brief Construct I2cAcquisition class.
+     *
+     * @param i2c                   Reference to the I2c connected to the device.
+     * @param trigger               Reference to the PeriodicTimer pacing the reads.
+     * @param timer                 Reference to a free-running Timer used for timestamps.
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        First register of the block.
+     * @param memory_address_size   Size of the register address (default is 8-bit).
+     */
+    I2cAcquisition(
+        I2cT& i2c,
+        PeriodicTimerT& trigger,
+        Timer& timer,
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size = I2cMemoryAddressSize::Bits8
+    ) noexcept
+      : m_i2c{i2c},
+        m_trigger{trigger},
+        m_timer{timer},
+        m_device_address{device_address},
+        m_memory_address{memory_address},
+        m_memory_address_size{memory_address_size}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cAcquisition(const I2cAcquisition&) = delete;
+    I2cAcquisition& operator=(const I2cAcquisition&) = delete;
+    I2cAcquisition(I2cAcquisition&&) = delete;
+    I2cAcquisition& operator=(I2cAcquisition&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cAcquisition class, stops the acquisition.
+     */
+    ~I2cAcquisition()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Start triggering reads on every timer update event.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start() noexcept
+    {
+        return m_trigger.Start([this](){
+            OnTrigger();
+        });
+    }
+
+    /**
+     * @brief Stop triggering reads, a read in progress still completes.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        return m_trigger.Stop();
+    }
+
+    /**
+     * @brief Take the oldest completed sample.
+     *
+     * @param sample    Reference to store the sample.
+     *
+     * @returns True if a sample was available, false otherwise.
+     */
+    bool Pop(SampleT& sample) noexcept
+    {
+        return m_ring.Pop(sample);
+    }
+
+    /**
+     * @returns Number of samples waiting in the ring.
+     */
+    [[nodiscard]]
+    std::size_t GetAvailableCount() const noexcept
+    {
+        return m_ring.Size();
+    }
+
+    /**
+     * @returns Number of triggers skipped because the previous read was still in progress.
+     */
+    [[nodiscard]]
+    std::uint32_t GetOverrunCount() const noexcept
+    {
+        return m_overrun_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns Number of samples dropped because the ring was full.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedCount() const noexcept
+    {
+        return m_dropped_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns Number of reads that failed to start or ended with a bus error.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_error_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    I2cT& m_i2c;
+    PeriodicTimerT& m_trigger;
+    Timer& m_timer;
+    std::uint16_t m_device_address;
+    std::uint16_t m_memory_address;
+    I2cMemoryAddressSize m_memory_address_size;
+    DmaBuffer<std::uint8_t, SampleSizeT::value> m_dma_buffer{};
+    std::uint32_t m_timestamp{0};
+    __Internal::__SpscRing<SampleT, RingSizeT::value> m_ring{};
+    std::atomic<bool> m_busy{false};
+    std::atomic<std::uint32_t> m_overrun_count{0};
+    std::atomic<std::uint32_t> m_dropped_count{0};
+    std::atomic<std::uint32_t> m_error_count{0};
+
+    /**
+     * @brief Stamp the trigger time and start the burst read.
+     */
+    void OnTrigger() noexcept
+    {
+        if (m_busy.load(std::memory_order_acquire)) {
+            m_overrun_count.store(GetOverrunCount() + 1, std::memory_order_relaxed);
+            return;
+        }
+        m_busy.store(true, std::memory_order_release);
+        m_timestamp = m_timer.Get();
+        const bool started = m_i2c.template MemoryReadTo<WorkingMode::DMA>(
+            m_device_address, m_memory_address, m_memory_address_size, m_dma_buffer,
+            [this](){
+                OnReadComplete();
+            },
+            [this](){
+                OnReadFailed();
+            }
+        );
+        if (!started) {
+            OnReadFailed();
+        }
+    }
+
+    /**
+     * @brief Count the failed read and release the bus for the next trigger.
+     */
+    void OnReadFailed() noexcept
+    {
+        m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+        m_busy.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy the completed sample straight into a free ring slot.
+     */
+    void OnReadComplete() noexcept
+    {
+        if (auto* sample = m_ring.Reserve()) {
+            std::ranges::copy(m_dma_buffer, sample->data.begin());
+            sample->timestamp = m_timestamp;
+            m_ring.Commit();
+        } else {
+            m_dropped_count.store(GetDroppedCount() + 1, std::memory_order_relaxed);
+        }
+        m_busy.store(false, std::memory_order_release);
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_I2C_ACQUISITION_HPP */
@@ -0,0 +1,443 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_I2C_EEPROM_HPP
+#define STM32_I2C_EEPROM_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "I2c.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct I2cEepromPageSize, A utility struct to hold the page size of an I2C EEPROM.
+ *
+ * @tparam PageSizeV    Page size in bytes from the datasheet (a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cEeprom.hpp>
+ *
+ * using Page24Lc512 = STM32::I2cEepromPageSize<128>;
+ * auto size = Page24Lc512::value; // size is 128.
+ * @endcode
+ */
+template <std::size_t PageSizeV>
+struct I2cEepromPageSize : __Internal::__Constant<std::size_t, PageSizeV> {
+    static_assert(
+        std::has_single_bit(PageSizeV),
+        "Page size must be a power of two"
+    );
+};
+
+/**
+ * @brief IsI2cEepromPageSize, A concept to check if a type is an I2cEepromPageSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cEeprom.hpp>
+ *
+ * static_assert(STM32::IsI2cEepromPageSize<STM32::I2cEepromPageSize<128>>);
+ * static_assert(!STM32::IsI2cEepromPageSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cEepromPageSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+/**
+ * @struct I2cEepromCapacity, A utility struct to hold the capacity of an I2C EEPROM.
+ *
+ * @tparam CapacityV    Capacity in bytes (e.g., 65536 for 24LC512), at most 65536.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cEeprom.hpp>
+ *
+ * using Capacity24Lc512 = STM32::I2cEepromCapacity<65536>;
+ * auto capacity = Capacity24Lc512::value; // capacity is 65536.
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct I2cEepromCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        CapacityV > 0 && CapacityV <= 65536,
+        "Capacity must be between 1 and 65536 bytes"
+    );
+};
+
+/**
+ * @brief IsI2cEepromCapacity, A concept to check if a type is an I2cEepromCapacity.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cEeprom.hpp>
+ *
+ * static_assert(STM32::IsI2cEepromCapacity<STM32::I2cEepromCapacity<65536>>);
+ * static_assert(!STM32::IsI2cEepromCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cEepromCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0 && T::value <= 65536;
+
+/**
+ * @class I2cEeprom, A 24xx series I2C EEPROM driver with page-aware DMA writes.
+ *
+ * Writes of any length are split at page boundaries. Each page is written via
+ * DMA; completion of the internal programming cycle is then detected by
+ * acknowledge polling from Tick(), so the next page starts as soon as the
+ * device is ready instead of after the worst-case write time. Each poll is a
+ * zero-length interrupt-driven write whose acknowledge or NACK advances the
+ * state machine, so Tick() never waits for the bus.
+ *
+ * Devices up to 2 KiB use 8-bit memory addresses with the block number in the
+ * device address (24xx04 to 24xx16), larger devices use 16-bit addresses.
+ *
+ * @tparam I2cT         I2c type.
+ * @tparam PageSizeT    Page size (e.g., I2cEepromPageSize<128>).
+ * @tparam CapacityT    Capacity (e.g., I2cEepromCapacity<65536>).
+ *
+ * @note I2cEeprom class is non-copyable and non-movable.
+ * @note Transfers carry their own error callback, the I2c error callback is
+ *       left untouched. Other devices on the bus may be accessed only while
+ *       IsBusy() returns false.
+ * @note Each Tick() starts at most one address probe and returns at once.
+ *       Call it at a fixed rate close to the expected polling interval,
+ *       e.g., every 200 us.
+ * @note The source buffer of Write() must stay valid until the callback runs.
+ * @note Callbacks run in interrupt context; LastOperationSucceeded() reports
+ *       the outcome inside them.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cEeprom.hpp>
+ * #include <STM32LibraryCollection/Timer.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized with DMA by CubeMX
+ * TIM_HandleTypeDef htim7; // Assume properly initialized for 5 kHz update rate
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cEeprom<
+ *     decltype(i2c), STM32::I2cEepromPageSize<128>, STM32::I2cEepromCapacity<65536>
+ * > eeprom{i2c, 0x50};
+ *
+ * STM32::PeriodicTimer<STM32_UNIQUE_TAG> poll{htim7};
+ * poll.Start([&eeprom](){
+ *     eeprom.Tick();
+ * });
+ *
+ * // 1. Write 1000 bytes starting mid-page, split into 9 page writes
+ * static std::array<std::uint8_t, 1000> log{};
+ * eeprom.Write(0x0140, log, [&eeprom](){
+ *     if (eeprom.LastOperationSucceeded()) {
+ *         // Data is programmed
+ *     }
+ * });
+ *
+ * // 2. Read back once idle
+ * STM32::DmaBuffer<std::uint8_t, 64> rx{};
+ * eeprom.ReadTo(0x0140, rx, [](){
+ *     // rx holds the data
+ * });
+ * @endcode
+ */
+template <IsI2c I2cT, IsI2cEepromPageSize PageSizeT, IsI2cEepromCapacity CapacityT>
+class I2cEeprom {
+    static constexpr std::size_t page_size{PageSizeT::value};
+    static constexpr std::size_t capacity{CapacityT::value};
+    static constexpr bool block_addressing{capacity <= 2048};
+    static constexpr auto memory_address_size{
+        block_addressing ? I2cMemoryAddressSize::Bits8 : I2cMemoryAddressSize::Bits16
+    };
+    static_assert(
+        page_size <= capacity && capacity % page_size == 0,
+        "Capacity must be a multiple of the page size"
+    );
+
+    enum class State : std::uint8_t {
+        Idle,
+        Reading,
+        Writing,
+        Polling,
+        Probing
+    };
+public:
+
+    /**
+     * @brief Construct I2cEeprom class.
+     *
+     * @param i2c               Reference to the I2c driving the bus.
+     * @param device_address    7-bit I2C device address (e.g., 0x50).
+     * @param max_poll_ticks    Ticks to wait for a page to be programmed before failing.
+     */
+    I2cEeprom(I2cT& i2c, std::uint16_t device_address, std::uint32_t max_poll_ticks = 100) noexcept
+      : m_i2c{i2c}, m_device_address{device_address}, m_max_poll_ticks{max_poll_ticks}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cEeprom(const I2cEeprom&) = delete;
+    I2cEeprom& operator=(const I2cEeprom&) = delete;
+    I2cEeprom(I2cEeprom&&) = delete;
+    I2cEeprom& operator=(I2cEeprom&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cEeprom class.
+     */
+    ~I2cEeprom() = default;
+
+    /**
+     * @returns Capacity in bytes.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Size() noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * @brief Write data of any length, split at page boundaries.
+     *
+     * @param address           Start address.
+     * @param tx_message        Data to write, must stay valid until completion.
+     * @param complete_callback Callback function to be called once all pages are programmed or on failure.
+     *
+     * @returns True if the write started, false if busy, empty, out of range or on I2C error.
+     */
+    bool Write(
+        std::size_t address,
+        std::span<const std::uint8_t> tx_message,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (tx_message.empty() || address >= capacity ||
+            tx_message.size() > capacity - address || !TryAcquire(State::Writing)) {
+            return false;
+        }
+        m_address = address;
+        m_remaining = tx_message;
+        m_complete_callback = std::move(complete_callback);
+        if (!WritePage()) {
+            m_complete_callback.Reset();
+            m_state.store(State::Idle, std::memory_order_release);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Read data via DMA.
+     *
+     * @param address           Start address.
+     * @param rx_message        A contiguous range to store the read data.
+     * @param complete_callback Callback function to be called upon completion or failure.
+     *
+     * @returns True if the read started, false if busy, out of range or on I2C error.
+     */
+    bool ReadTo(
+        std::size_t address,
+        IsI2cMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (address >= capacity || std::ranges::size(rx_message) > capacity - address ||
+            !TryAcquire(State::Reading)) {
+            return false;
+        }
+        m_complete_callback = std::move(complete_callback);
+        const bool started = m_i2c.template MemoryReadTo<WorkingMode::DMA>(
+            DeviceAddressOf(address), MemoryAddressOf(address), memory_address_size,
+            rx_message,
+            [this](){
+                Finish(true);
+            },
+            [this](){
+                Finish(false);
+            }
+        );
+        if (!started) {
+            m_complete_callback.Reset();
+            m_state.store(State::Idle, std::memory_order_release);
+        }
+        return started;
+    }
+
+    /**
+     * @brief Poll the device while a page is being programmed.
+     *
+     * Starts a zero-length write to the device; its acknowledge continues with
+     * the next page, a NACK leaves the poll to the next tick.
+     *
+     * @note Call at a fixed rate, e.g., from a PeriodicTimer callback.
+     */
+    void Tick() noexcept
+    {
+        auto expected = State::Polling;
+        if (!m_state.compare_exchange_strong(expected, State::Probing, std::memory_order_acq_rel)) {
+            return;
+        }
+        static constexpr std::array<std::uint8_t, 1> probe{};
+        const bool started = m_i2c.template Transmit<WorkingMode::Interrupt>(
+            DeviceAddressOf(m_address),
+            std::span{probe}.first(0),
+            [this](){
+                OnProbeAcknowledged();
+            },
+            [this](){
+                OnProbeRejected();
+            }
+        );
+        if (!started) {
+            OnProbeRejected();
+        }
+    }
+
+    /**
+     * @returns True if a read or write is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_state.load(std::memory_order_acquire) != State::Idle;
+    }
+
+    /**
+     * @returns Outcome of the operation whose callback is running.
+     */
+    [[nodiscard]]
+    bool LastOperationSucceeded() const noexcept
+    {
+        return m_last_operation_succeeded;
+    }
+
+private:
+    I2cT& m_i2c;
+    std::uint16_t m_device_address;
+    std::uint32_t m_max_poll_ticks;
+    std::uint32_t m_poll_ticks{0};
+    std::size_t m_address{0};
+    std::size_t m_page_length{0};
+    std::span<const std::uint8_t> m_remaining{};
+    CallbackT m_complete_callback{};
+    std::atomic<State> m_state{State::Idle};
+    bool m_last_operation_succeeded{true};
+
+    /**
+     * @returns True if the driver was idle and is now in the given state.
+     */
+    bool TryAcquire(State state) noexcept
+    {
+        auto expected = State::Idle;
+        return m_state.compare_exchange_strong(expected, state, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @returns Device address carrying the block number for small devices.
+     */
+    std::uint16_t DeviceAddressOf(std::size_t address) const noexcept
+    {
+        if constexpr (block_addressing) {
+            return static_cast<std::uint16_t>(m_device_address | ((address >> 8) & 0x07));
+        } else {
+            return m_device_address;
+        }
+    }
+
+    /**
+     * @returns Memory address sent after the device address.
+     */
+    static constexpr std::uint16_t MemoryAddressOf(std::size_t address) noexcept
+    {
+        if constexpr (block_addressing) {
+            return static_cast<std::uint16_t>(address & 0xFF);
+        } else {
+            return static_cast<std::uint16_t>(address);
+        }
+    }
+
+    /**
+     * @brief Start the write of the part of the remaining data within the current page.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool WritePage() noexcept
+    {
+        m_page_length = std::min(m_remaining.size(), page_size - (m_address % page_size));
+        m_poll_ticks = 0;
+        m_state.store(State::Writing, std::memory_order_release);
+        return m_i2c.template MemoryWrite<WorkingMode::DMA>(
+            DeviceAddressOf(m_address), MemoryAddressOf(m_address), memory_address_size,
+            m_remaining.first(m_page_length),
+            [this](){
+                m_state.store(State::Polling, std::memory_order_release);
+            },
+            [this](){
+                Finish(false);
+            }
+        );
+    }
+
+    /**
+     * @brief The device acknowledged, the page is programmed: write the next one or finish.
+     */
+    void OnProbeAcknowledged() noexcept
+    {
+        m_address += m_page_length;
+        m_remaining = m_remaining.subspan(m_page_length);
+        if (m_remaining.empty()) {
+            Finish(true);
+        } else if (!WritePage()) {
+            Finish(false);
+        }
+    }
+
+    /**
+     * @brief The device is still programming (NACK) or the bus was busy: poll again on the next tick.
+     */
+    void OnProbeRejected() noexcept
+    {
+        if (++m_poll_ticks >= m_max_poll_ticks) {
+            Finish(false);
+        } else {
+            m_state.store(State::Polling, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Return to idle and invoke the complete callback.
+     */
+    void Finish(bool success) noexcept
+    {
+        if (m_state.load(std::memory_order_acquire) == State::Idle) {
+            return;
+        }
+        auto callback = std::move(m_complete_callback);
+        m_last_operation_succeeded = success;
+        m_state.store(State::Idle, std::memory_order_release);
+        callback();
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_I2C_EEPROM_HPP */
@@ -0,0 +1,612 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_I2C_SCHEDULER_HPP
+#define STM32_I2C_SCHEDULER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "DmaBuffer.hpp"
+#include "I2c.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct I2cTransfer, A description of a single I2C transaction.
+ *
+ * Buffers are referenced, not copied; they must stay valid until the
+ * transaction completes.
+ *
+ * @note Receive buffers are DmaBuffer::Span(), so a DMA receive on cores with
+ *       data cache never invalidates a cache line shared with other data.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ *
+ * STM32::DmaBuffer<std::uint8_t, 6> accel{};
+ * std::array<std::uint8_t, 2> reset{0x6B, 0x80};
+ *
+ * // Register read with repeated start (write 0x3B, then read 6 bytes)
+ * auto read = STM32::I2cTransfer::MemoryRead(0x68, 0x3B, STM32::I2cMemoryAddressSize::Bits8, accel.Span());
+ *
+ * // Plain write
+ * auto write = STM32::I2cTransfer::Write(0x68, reset);
+ * @endcode
+ */
+struct I2cTransfer {
+
+    /**
+     * @enum Kind, Type of the transaction.
+     */
+    enum class Kind {
+        Write,          /**< Master transmit */
+        Read,           /**< Master receive */
+        MemoryWrite,    /**< Register address followed by data */
+        MemoryRead,     /**< Register address, repeated start, then read */
+        WriteThenRead   /**< Arbitrary write, repeated start, then read */
+    };
+
+    Kind kind{Kind::Write};
+    std::uint16_t device_address{};
+    std::uint16_t memory_address{};
+    I2cMemoryAddressSize memory_address_size{I2cMemoryAddressSize::Bits8};
+    std::span<const std::uint8_t> tx_message{};
+    DmaSpan<std::uint8_t> rx_message{};
+
+    /**
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param tx_message        Data to transmit.
+     *
+     * @returns Master transmit transaction.
+     */
+    [[nodiscard]]
+    static constexpr I2cTransfer Write(
+        std::uint16_t device_address,
+        std::span<const std::uint8_t> tx_message
+    ) noexcept
+    {
+        return {Kind::Write, device_address, 0, I2cMemoryAddressSize::Bits8, tx_message, {}};
+    }
+
+    /**
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param rx_message        Buffer to store the received data.
+     *
+     * @returns Master receive transaction.
+     */
+    [[nodiscard]]
+    static constexpr I2cTransfer Read(
+        std::uint16_t device_address,
+        DmaSpan<std::uint8_t> rx_message
+    ) noexcept
+    {
+        return {Kind::Read, device_address, 0, I2cMemoryAddressSize::Bits8, {}, rx_message};
+    }
+
+    /**
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param tx_message            Data to write.
+     *
+     * @returns Memory/register write transaction.
+     */
+    [[nodiscard]]
+    static constexpr I2cTransfer MemoryWrite(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        std::span<const std::uint8_t> tx_message
+    ) noexcept
+    {
+        return {Kind::MemoryWrite, device_address, memory_address, memory_address_size, tx_message, {}};
+    }
+
+    /**
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address        Memory/register address.
+     * @param memory_address_size   Size of the memory/register address.
+     * @param rx_message            Buffer to store the read data.
+     *
+     * @returns Memory/register read (write-then-read with repeated start) transaction.
+     */
+    [[nodiscard]]
+    static constexpr I2cTransfer MemoryRead(
+        std::uint16_t device_address,
+        std::uint16_t memory_address,
+        I2cMemoryAddressSize memory_address_size,
+        DmaSpan<std::uint8_t> rx_message
+    ) noexcept
+    {
+        return {Kind::MemoryRead, device_address, memory_address, memory_address_size, {}, rx_message};
+    }
+
+    /**
+     * @param device_address    7-bit I2C device address (0x00-0x7F).
+     * @param tx_message        Data to transmit.
+     * @param rx_message        Buffer to store the received data.
+     *
+     * @returns Write-then-read transaction joined by a repeated start
+     *          (for devices not following the register read pattern).
+     */
+    [[nodiscard]]
+    static constexpr I2cTransfer WriteThenRead(
+        std::uint16_t device_address,
+        std::span<const std::uint8_t> tx_message,
+        DmaSpan<std::uint8_t> rx_message
+    ) noexcept
+    {
+        return {Kind::WriteThenRead, device_address, 0, I2cMemoryAddressSize::Bits8, tx_message, rx_message};
+    }
+};
+
+/**
+ * @struct I2cSchedulerQueueSize, A utility struct to hold the number of queued transactions.
+ *
+ * @tparam QueueSizeV   Maximum number of pending transactions, one-shot and periodic.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ *
+ * using MyQueue = STM32::I2cSchedulerQueueSize<16>;
+ * auto size = MyQueue::value; // size is 16.
+ * @endcode
+ */
+template <std::size_t QueueSizeV>
+struct I2cSchedulerQueueSize : __Internal::__Constant<std::size_t, QueueSizeV> {
+    static_assert(
+        QueueSizeV > 0,
+        "Queue size must be greater than zero"
+    );
+};
+
+/**
+ * @brief IsI2cSchedulerQueueSize, A concept to check if a type is an I2cSchedulerQueueSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ *
+ * static_assert(STM32::IsI2cSchedulerQueueSize<STM32::I2cSchedulerQueueSize<16>>);
+ * static_assert(!STM32::IsI2cSchedulerQueueSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cSchedulerQueueSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0;
+
+/**
+ * @struct I2cSchedulerJobCount, A utility struct to hold the number of periodic jobs.
+ *
+ * @tparam JobCountV    Maximum number of periodic jobs (may be zero).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ *
+ * using MyJobs = STM32::I2cSchedulerJobCount<12>;
+ * auto count = MyJobs::value; // count is 12.
+ * @endcode
+ */
+template <std::size_t JobCountV>
+struct I2cSchedulerJobCount : __Internal::__Constant<std::size_t, JobCountV> { };
+
+/**
+ * @brief IsI2cSchedulerJobCount, A concept to check if a type is an I2cSchedulerJobCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ *
+ * static_assert(STM32::IsI2cSchedulerJobCount<STM32::I2cSchedulerJobCount<12>>);
+ * static_assert(!STM32::IsI2cSchedulerJobCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cSchedulerJobCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t>;
+
+/**
+ * @class I2cScheduler, A transaction queue serializing many devices on one I2C bus.
+ *
+ * Transactions are executed in submission order. Each one is started from the
+ * completion (or error) callback of the previous one, so the bus runs back to
+ * back without polling. Periodic jobs are queued by Tick() when their period
+ * elapses and take their turn behind already queued transactions; a job is not
+ * queued again while its previous run is still pending, so a slow bus delays
+ * jobs instead of flooding the queue.
+ *
+ * @tparam I2cT             I2c type.
+ * @tparam QueueSizeT       Maximum number of pending transactions (e.g., I2cSchedulerQueueSize<16>).
+ * @tparam JobCountT        Maximum number of periodic jobs (e.g., I2cSchedulerJobCount<12>).
+ * @tparam WorkingModeT     Working mode of the transfers (WorkingMode::Interrupt or WorkingMode::DMA).
+ *
+ * @note I2cScheduler class is non-copyable and non-movable.
+ * @note Transactions carry their own error callback, the I2c error callback set
+ *       with SetErrorCallback is left untouched. Do not start transfers on the
+ *       I2c directly while the scheduler is in use.
+ * @note Callbacks run in interrupt context, after the next transaction has
+ *       been started. LastTransferSucceeded() reports the outcome inside them.
+ * @note Submit() and Tick() may be called from the main loop and interrupts.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cScheduler.hpp>
+ * #include <STM32LibraryCollection/Timer.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized with DMA by CubeMX
+ * TIM_HandleTypeDef htim6; // Assume properly initialized for 1 kHz update rate
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cScheduler<
+ *     decltype(i2c), STM32::I2cSchedulerQueueSize<16>, STM32::I2cSchedulerJobCount<12>
+ * > scheduler{i2c};
+ *
+ * STM32::DmaBuffer<std::uint8_t, 6> accel{};
+ * STM32::DmaBuffer<std::uint8_t, 3> pressure{};
+ *
+ * // 1. Periodic jobs: accelerometer every 1 ms, barometer every 20 ms
+ * scheduler.AddPeriodic(1, STM32::I2cTransfer::MemoryRead(0x68, 0x3B, STM32::I2cMemoryAddressSize::Bits8, accel.Span()), [](){
+ *     // accel holds a fresh sample
+ * });
+ * scheduler.AddPeriodic(20, STM32::I2cTransfer::MemoryRead(0x76, 0xF7, STM32::I2cMemoryAddressSize::Bits8, pressure.Span()), [&scheduler](){
+ *     if (scheduler.LastTransferSucceeded()) {
+ *         // pressure holds a fresh sample
+ *     }
+ * });
+ *
+ * STM32::PeriodicTimer<STM32_UNIQUE_TAG> tick{htim6};
+ * tick.Start([&scheduler](){
+ *     scheduler.Tick();
+ * });
+ *
+ * // 2. One-shot transaction, queued behind the pending ones
+ * static constexpr std::array<std::uint8_t, 1> reset{0xB6};
+ * scheduler.Submit(STM32::I2cTransfer::MemoryWrite(0x76, 0xE0, STM32::I2cMemoryAddressSize::Bits8, reset), [](){
+ *     // Reset command sent
+ * });
+ * @endcode
+ */
+template <
+    IsI2c I2cT,
+    IsI2cSchedulerQueueSize QueueSizeT,
+    IsI2cSchedulerJobCount JobCountT = I2cSchedulerJobCount<0>,
+    IsWorkingMode WorkingModeT = WorkingMode::DMA
+>
+requires (!std::same_as<WorkingModeT, WorkingMode::Blocking>)
+class I2cScheduler {
+    static constexpr std::size_t queue_size{QueueSizeT::value};
+    static constexpr std::size_t job_count{JobCountT::value};
+    static constexpr std::size_t no_job{job_count};
+
+    struct Entry {
+        I2cTransfer transfer{};
+        CallbackT callback{};
+        std::size_t job{no_job};
+    };
+
+    struct Job {
+        I2cTransfer transfer{};
+        CallbackT callback{};
+        std::uint32_t period{};
+        std::uint32_t countdown{};
+        bool active{false};
+        bool pending{false};
+    };
+
+    struct Finished {
+        CallbackT callback{};
+        std::size_t job{no_job};
+    };
+public:
+
+    /**
+     * @brief Construct I2cScheduler class.
+     *
+     * @param i2c   Reference to the I2c driving the bus.
+     */
+    explicit I2cScheduler(I2cT& i2c) noexcept
+      : m_i2c{i2c}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cScheduler(const I2cScheduler&) = delete;
+    I2cScheduler& operator=(const I2cScheduler&) = delete;
+    I2cScheduler(I2cScheduler&&) = delete;
+    I2cScheduler& operator=(I2cScheduler&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cScheduler class.
+     *
+     * @note The transaction in progress, if any, must have completed.
+     */
+    ~I2cScheduler() = default;
+
+    /**
+     * @brief Queue a one-shot transaction.
+     *
+     * The transaction starts immediately if the bus is idle.
+     *
+     * @param transfer          Transaction to execute.
+     * @param complete_callback Callback function to be called upon completion or failure.
+     *
+     * @returns True if queued, false if the queue is full.
+     */
+    bool Submit(const I2cTransfer& transfer, CallbackT&& complete_callback = [](){}) noexcept
+    {
+        {
+            __Internal::__CriticalSection guard{};
+            if (!Push(transfer, std::move(complete_callback), no_job)) {
+                return false;
+            }
+        }
+        StartNext();
+        return true;
+    }
+
+    /**
+     * @brief Add a periodic job.
+     *
+     * @param period            Period in Tick() calls (must be > 0).
+     * @param transfer          Transaction executed on every period.
+     * @param complete_callback Callback function to be called upon each completion or failure.
+     *
+     * @returns True if added, false if the period is zero or all job slots are in use.
+     */
+    bool AddPeriodic(
+        std::uint32_t period,
+        const I2cTransfer& transfer,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (period == 0) {
+            return false;
+        }
+        __Internal::__CriticalSection guard{};
+        for (auto& job : m_jobs) {
+            if (!job.active && !job.pending) {
+                job.transfer = transfer;
+                job.callback = std::move(complete_callback);
+                job.period = period;
+                job.countdown = period;
+                job.active = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Advance the periodic jobs by one tick and queue the due ones.
+     *
+     * @note Call at a fixed rate, e.g., from a PeriodicTimer callback.
+     */
+    void Tick() noexcept
+    {
+        {
+            __Internal::__CriticalSection guard{};
+            for (std::size_t i = 0; i < job_count; ++i) {
+                auto& job = m_jobs[i];
+                if (!job.active || --job.countdown != 0) {
+                    continue;
+                }
+                job.countdown = job.period;
+                if (!job.pending && Push(job.transfer, CallbackT{}, i)) {
+                    job.pending = true;
+                } else {
+                    ++m_skipped_job_count;
+                }
+            }
+        }
+        StartNext();
+    }
+
+    /**
+     * @returns True if a transaction is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_busy.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns Outcome of the transaction whose callback is running.
+     */
+    [[nodiscard]]
+    bool LastTransferSucceeded() const noexcept
+    {
+        return m_last_transfer_succeeded;
+    }
+
+    /**
+     * @returns Number of periodic runs skipped because the previous run was
+     *          still pending or the queue was full.
+     */
+    [[nodiscard]]
+    std::uint32_t GetSkippedJobCount() const noexcept
+    {
+        return m_skipped_job_count;
+    }
+
+private:
+    I2cT& m_i2c;
+    std::array<Entry, queue_size> m_queue{};
+    std::array<Job, job_count> m_jobs{};
+    Entry m_current{};
+    std::size_t m_head{0};
+    std::size_t m_count{0};
+    std::uint32_t m_skipped_job_count{0};
+    std::atomic<bool> m_busy{false};
+    bool m_last_transfer_succeeded{true};
+
+    /**
+     * @brief Append a transaction to the queue.
+     *
+     * @note Must be called inside a critical section.
+     *
+     * @returns True on success, false if the queue is full.
+     */
+    bool Push(const I2cTransfer& transfer, CallbackT&& callback, std::size_t job) noexcept
+    {
+        if (m_count == queue_size) {
+            return false;
+        }
+        auto& entry = m_queue[(m_head + m_count) % queue_size];
+        entry.transfer = transfer;
+        entry.callback = std::move(callback);
+        entry.job = job;
+        ++m_count;
+        return true;
+    }
+
+    /**
+     * @brief Take ownership of the bus and move the oldest transaction to m_current.
+     *
+     * @returns True if a transaction was taken, false if the bus is busy or the queue is empty.
+     */
+    bool Acquire() noexcept
+    {
+        __Internal::__CriticalSection guard{};
+        if (m_busy.load(std::memory_order_relaxed) || m_count == 0) {
+            return false;
+        }
+        m_current = std::move(m_queue[m_head]);
+        m_head = (m_head + 1) % queue_size;
+        --m_count;
+        m_busy.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Release the bus after the current transaction.
+     *
+     * @returns Callback of the finished transaction.
+     */
+    Finished Release() noexcept
+    {
+        Finished finished{std::move(m_current.callback), m_current.job};
+        __Internal::__CriticalSection guard{};
+        if (finished.job != no_job) {
+            m_jobs[finished.job].pending = false;
+        }
+        m_busy.store(false, std::memory_order_release);
+        return finished;
+    }
+
+    /**
+     * @brief Invoke the callback of a finished transaction.
+     */
+    void Notify(const Finished& finished, bool success) noexcept
+    {
+        m_last_transfer_succeeded = success;
+        if (finished.job != no_job) {
+            m_jobs[finished.job].callback();
+        } else {
+            finished.callback();
+        }
+    }
+
+    /**
+     * @brief Start the oldest queued transaction.
+     *
+     * @returns The transaction if the bus refused it, std::nullopt if it was
+     *          started or nothing could be taken.
+     */
+    std::optional<Finished> TryStart() noexcept
+    {
+        if (!Acquire() || StartCurrent()) {
+            return std::nullopt;
+        }
+        return Release();
+    }
+
+    /**
+     * @brief Start queued transactions until one is accepted by the bus.
+     */
+    void StartNext() noexcept
+    {
+        while (auto failed = TryStart()) {
+            Notify(*failed, false);
+        }
+    }
+
+    /**
+     * @brief Complete the current transaction and start the next one back to back.
+     *
+     * The finished transaction is notified before a start failure of the next
+     * one, so callbacks always run in submission order.
+     */
+    void OnTransferComplete(bool success) noexcept
+    {
+        const auto finished = Release();
+        const auto failed = TryStart();
+        Notify(finished, success);
+        if (failed) {
+            Notify(*failed, false);
+            StartNext();
+        }
+    }
+
+    /**
+     * @returns True if the current transaction was started, false otherwise.
+     */
+    bool StartCurrent() noexcept
+    {
+        auto& transfer = m_current.transfer;
+        auto on_complete = [this](){
+            OnTransferComplete(true);
+        };
+        auto on_error = [this](){
+            OnTransferComplete(false);
+        };
+        switch (transfer.kind) {
+        case I2cTransfer::Kind::Write:
+            return m_i2c.template Transmit<WorkingModeT>(
+                transfer.device_address, transfer.tx_message, on_complete, on_error
+            );
+        case I2cTransfer::Kind::Read:
+            return m_i2c.template ReceiveTo<WorkingModeT>(
+                transfer.device_address, transfer.rx_message, on_complete, on_error
+            );
+        case I2cTransfer::Kind::MemoryWrite:
+            return m_i2c.template MemoryWrite<WorkingModeT>(
+                transfer.device_address, transfer.memory_address,
+                transfer.memory_address_size, transfer.tx_message, on_complete, on_error
+            );
+        case I2cTransfer::Kind::MemoryRead:
+            return m_i2c.template MemoryReadTo<WorkingModeT>(
+                transfer.device_address, transfer.memory_address,
+                transfer.memory_address_size, transfer.rx_message, on_complete, on_error
+            );
+        case I2cTransfer::Kind::WriteThenRead:
+            return m_i2c.template TransmitThenReceiveTo<WorkingModeT>(
+                transfer.device_address, transfer.tx_message, transfer.rx_message, on_complete, on_error
+            );
+        }
+        return false;
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_I2C_SCHEDULER_HPP */
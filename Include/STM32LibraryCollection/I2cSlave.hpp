@@ -0,0 +1,513 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_I2C_SLAVE_HPP
+#define STM32_I2C_SLAVE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "I2c.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct I2cSlaveRegisterCount, A utility struct to hold the size of the slave register file.
+ *
+ * @tparam RegisterCountV   Number of 8-bit registers exposed to the host (1 to 256).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cSlave.hpp>
+ *
+ * using MyRegisters = STM32::I2cSlaveRegisterCount<256>;
+ * auto count = MyRegisters::value; // count is 256.
+ * @endcode
+ */
+template <std::size_t RegisterCountV>
+struct I2cSlaveRegisterCount : __Internal::__Constant<std::size_t, RegisterCountV> {
+    static_assert(
+        RegisterCountV > 0 && RegisterCountV <= 256,
+        "Register count must be between 1 and 256"
+    );
+};
+
+/**
+ * @brief IsI2cSlaveRegisterCount, A concept to check if a type is an I2cSlaveRegisterCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cSlave.hpp>
+ *
+ * static_assert(STM32::IsI2cSlaveRegisterCount<STM32::I2cSlaveRegisterCount<256>>);
+ * static_assert(!STM32::IsI2cSlaveRegisterCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cSlaveRegisterCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0 && T::value <= 256;
+
+/**
+ * @struct I2cSlaveWatcherCount, A utility struct to hold the number of register change watchers.
+ *
+ * @tparam WatcherCountV    Maximum number of OnChange() registrations.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cSlave.hpp>
+ *
+ * using MyWatchers = STM32::I2cSlaveWatcherCount<4>;
+ * auto count = MyWatchers::value; // count is 4.
+ * @endcode
+ */
+template <std::size_t WatcherCountV>
+struct I2cSlaveWatcherCount : __Internal::__Constant<std::size_t, WatcherCountV> { };
+
+/**
+ * @brief IsI2cSlaveWatcherCount, A concept to check if a type is an I2cSlaveWatcherCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cSlave.hpp>
+ *
+ * static_assert(STM32::IsI2cSlaveWatcherCount<STM32::I2cSlaveWatcherCount<4>>);
+ * static_assert(!STM32::IsI2cSlaveWatcherCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cSlaveWatcherCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t>;
+
+/**
+ * @class I2cSlave, An I2C slave exposing a register file in RAM to the host.
+ *
+ * The host accesses the register file like a typical sensor:
+ * - Write: the first byte sets the register pointer, following bytes are
+ *   written to consecutive registers.
+ * - Read: registers are sent starting at the register pointer. A read may
+ *   follow a write of the pointer with a repeated START.
+ *
+ * Reads are served by DMA directly from the register file, so a burst read of
+ * the whole file costs two interrupts. Written bytes are collected and applied
+ * when the write ends; registers whose value changed trigger the callbacks
+ * registered with OnChange().
+ *
+ * @tparam UniqueTagT       Unique tag type, must be STM32_UNIQUE_TAG.
+ * @tparam RegisterCountT   Size of the register file (e.g., I2cSlaveRegisterCount<256>).
+ * @tparam WatcherCountT    Maximum number of change watchers (default is 8).
+ *
+ * @note I2cSlave class is non-copyable and non-movable.
+ * @note The own address is configured by CubeMX in the I2C handle.
+ * @note Reads do not move the register pointer; it stays at the last written value.
+ * @note The pointer wraps modulo the register count: reads past the end continue
+ *       at the first register, writes past the end are ignored.
+ * @note A transfer ended by a bus error discards the bytes written so far.
+ * @note Change callbacks run in interrupt context.
+ * @note The host may observe a multi-byte value partially updated by
+ *       Write() if it reads at the same time; use a status flag register
+ *       to signal consistent data when this matters.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2cSlave.hpp>
+ *
+ * I2C_HandleTypeDef hi2c2; // Assume properly initialized as slave with DMA by CubeMX
+ *
+ * STM32::I2cSlave<STM32_UNIQUE_TAG, STM32::I2cSlaveRegisterCount<256>> slave{hi2c2};
+ *
+ * // 1. Publish measurements for the host
+ * std::array<std::uint8_t, 4> temperature{0x00, 0x00, 0x09, 0xC4};
+ * slave.Write(0x10, temperature);
+ *
+ * // 2. React to configuration written by the host
+ * slave.OnChange(0x40, 2, [&slave](){
+ *     auto mode = slave.Read(0x40);
+ *     // Apply new mode
+ * });
+ *
+ * // 3. Start answering the host
+ * slave.Start();
+ * @endcode
+ */
+template <
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsI2cSlaveRegisterCount RegisterCountT,
+    IsI2cSlaveWatcherCount WatcherCountT = I2cSlaveWatcherCount<8>
+>
+class I2cSlave {
+    using SlaveTransmitCompleteCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_SLAVE_TX_COMPLETE_CB_ID
+    >;
+    using SlaveReceiveCompleteCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_SLAVE_RX_COMPLETE_CB_ID
+    >;
+    using ListenCompleteCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_LISTEN_COMPLETE_CB_ID
+    >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_ERROR_CB_ID
+    >;
+
+    static constexpr std::size_t register_count{RegisterCountT::value};
+
+    enum class Phase : std::uint8_t {
+        Idle,
+        Pointer,
+        Writing,
+        Reading
+    };
+
+    struct Watcher {
+        std::size_t first{};
+        std::size_t count{};
+        CallbackT callback{};
+    };
+public:
+
+    /**
+     * @brief Construct I2cSlave class.
+     *
+     * @param handle    Reference to the I2C handle.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    explicit I2cSlave(I2C_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_slave_transmit_complete_callback{handle},
+        m_slave_receive_complete_callback{handle},
+        m_listen_complete_callback{handle},
+        m_error_callback{handle}
+    {
+        s_instance = this;
+        HAL_I2C_RegisterAddrCallback(&m_handle, &I2cSlave::OnAddress);
+        m_slave_transmit_complete_callback.Set([this](){
+            OnRegistersTransmitted();
+        });
+        m_slave_receive_complete_callback.Set([this](){
+            OnByteReceived();
+        });
+        m_listen_complete_callback.Set([this](){
+            EndTransaction();
+        });
+        m_error_callback.Set([this](){
+            OnError();
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cSlave(const I2cSlave&) = delete;
+    I2cSlave& operator=(const I2cSlave&) = delete;
+    I2cSlave(I2cSlave&&) = delete;
+    I2cSlave& operator=(I2cSlave&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cSlave class.
+     *
+     * @note Stops listening and unregisters the address callback.
+     */
+    ~I2cSlave()
+    {
+        Stop();
+        HAL_I2C_UnRegisterAddrCallback(&m_handle);
+        s_instance = nullptr;
+    }
+
+    /**
+     * @returns I2C handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @returns Number of registers.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Size() noexcept
+    {
+        return register_count;
+    }
+
+    /**
+     * @brief Start acknowledging the own address.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start() noexcept
+    {
+        m_listening = true;
+        return (HAL_OK == HAL_I2C_EnableListen_IT(&m_handle));
+    }
+
+    /**
+     * @brief Stop acknowledging the own address.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_listening = false;
+        return (HAL_OK == HAL_I2C_DisableListen_IT(&m_handle));
+    }
+
+    /**
+     * @brief Update registers for the host to read.
+     *
+     * @param offset        First register.
+     * @param tx_message    New register contents.
+     *
+     * @returns True on success, false if the range exceeds the register file.
+     */
+    bool Write(std::size_t offset, std::span<const std::uint8_t> tx_message) noexcept
+    {
+        if (offset > register_count || tx_message.size() > register_count - offset) {
+            return false;
+        }
+        std::ranges::copy(tx_message, m_registers.begin() + offset);
+        return true;
+    }
+
+    /**
+     * @param offset    Register index (unchecked).
+     *
+     * @returns Current register value.
+     */
+    [[nodiscard]]
+    std::uint8_t Read(std::size_t offset) const noexcept
+    {
+        return m_registers[offset];
+    }
+
+    /**
+     * @returns Read-only view of the whole register file.
+     */
+    [[nodiscard]]
+    std::span<const std::uint8_t, register_count> Registers() const noexcept
+    {
+        return std::span<const std::uint8_t, register_count>{m_registers.data(), register_count};
+    }
+
+    /**
+     * @brief Register a callback invoked when the host changes any register in a range.
+     *
+     * @param first             First watched register.
+     * @param count             Number of watched registers.
+     * @param change_callback   Callback function invoked once per host write that changed the range.
+     *
+     * @returns True on success, false if the range is invalid or all watchers are in use.
+     */
+    bool OnChange(std::size_t first, std::size_t count, CallbackT&& change_callback) noexcept
+    {
+        if (count == 0 || first >= register_count || count > register_count - first ||
+            m_watcher_count == WatcherCountT::value) {
+            return false;
+        }
+        m_watchers[m_watcher_count] = Watcher{first, count, std::move(change_callback)};
+        ++m_watcher_count;
+        return true;
+    }
+
+private:
+    I2C_HandleTypeDef& m_handle;
+    SlaveTransmitCompleteCallbackT m_slave_transmit_complete_callback;
+    SlaveReceiveCompleteCallbackT m_slave_receive_complete_callback;
+    ListenCompleteCallbackT m_listen_complete_callback;
+    ErrorCallbackT m_error_callback;
+    DmaBuffer<std::uint8_t, register_count> m_registers{};
+    std::array<std::uint8_t, register_count> m_staging{};
+    std::array<bool, register_count> m_changed{};
+    std::array<Watcher, WatcherCountT::value> m_watchers{};
+    std::size_t m_watcher_count{0};
+    std::size_t m_pointer{0};
+    std::size_t m_staged_count{0};
+    std::uint8_t m_rx_byte{0};
+    Phase m_phase{Phase::Idle};
+    bool m_listening{false};
+
+    static inline I2cSlave* s_instance{nullptr};
+
+    /**
+     * @brief HAL address match callback.
+     *
+     * @param handle        Pointer to the I2C handle (unused).
+     * @param direction     I2C_DIRECTION_TRANSMIT if the host writes, I2C_DIRECTION_RECEIVE if it reads.
+     * @param address       Matched address (unused).
+     */
+    static void OnAddress(
+        [[maybe_unused]] I2C_HandleTypeDef* handle,
+        std::uint8_t direction,
+        [[maybe_unused]] std::uint16_t address
+    ) noexcept
+    {
+        if (s_instance) {
+            s_instance->OnAddressMatch(direction);
+        }
+    }
+
+    /**
+     * @brief Start the slave side of a transfer requested by the host.
+     */
+    void OnAddressMatch(std::uint8_t direction) noexcept
+    {
+        if (direction == I2C_DIRECTION_TRANSMIT) {
+            m_phase = Phase::Pointer;
+            m_staged_count = 0;
+            if (HAL_OK != HAL_I2C_Slave_Seq_Receive_IT(&m_handle, &m_rx_byte, 1, I2C_FIRST_FRAME)) {
+                AbortTransaction();
+            }
+            return;
+        }
+        ApplyWrite();
+        m_phase = Phase::Reading;
+        if (!TransmitRegisters(m_pointer)) {
+            AbortTransaction();
+        }
+    }
+
+    /**
+     * @brief Serve the register file from an offset to its end.
+     *
+     * The frame is not the last one, so a host reading past the end is served
+     * again from the first register (see OnRegistersTransmitted()).
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool TransmitRegisters(std::size_t offset) noexcept
+    {
+        const auto size = static_cast<std::uint16_t>(register_count - offset);
+        __Internal::__CleanDCache(m_registers.data() + offset, size);
+        return (HAL_OK == HAL_I2C_Slave_Seq_Transmit_DMA(
+            &m_handle, m_registers.data() + offset, size, I2C_NEXT_FRAME
+        ));
+    }
+
+    /**
+     * @brief The host read up to the last register, wrap to the first one.
+     */
+    void OnRegistersTransmitted() noexcept
+    {
+        if (m_phase == Phase::Reading && !TransmitRegisters(0)) {
+            AbortTransaction();
+        }
+    }
+
+    /**
+     * @brief Take the register pointer or stage a written byte, then wait for the next one.
+     */
+    void OnByteReceived() noexcept
+    {
+        if (m_phase == Phase::Pointer) {
+            m_pointer = m_rx_byte % register_count;
+            m_phase = Phase::Writing;
+        } else if (m_phase == Phase::Writing && m_pointer + m_staged_count < register_count) {
+            m_staging[m_staged_count++] = m_rx_byte;
+        }
+        if (HAL_OK != HAL_I2C_Slave_Seq_Receive_IT(&m_handle, &m_rx_byte, 1, I2C_NEXT_FRAME)) {
+            AbortTransaction();
+        }
+    }
+
+    /**
+     * @brief HAL error callback.
+     *
+     * A NACK alone is how transfers normally end: the host NACKs the last byte
+     * it reads, and a STOP during the pending one-byte receive of a write is
+     * reported as a NACK too. Any other error discards the transfer.
+     */
+    void OnError() noexcept
+    {
+        if (HAL_I2C_GetError(&m_handle) == HAL_I2C_ERROR_AF) {
+            EndTransaction();
+        } else {
+            AbortTransaction();
+        }
+    }
+
+    /**
+     * @brief Finish the transfer on STOP (or NACK) and listen again.
+     */
+    void EndTransaction() noexcept
+    {
+        ApplyWrite();
+        m_phase = Phase::Idle;
+        Listen();
+    }
+
+    /**
+     * @brief Drop the transfer without applying staged bytes and listen again.
+     */
+    void AbortTransaction() noexcept
+    {
+        m_staged_count = 0;
+        m_phase = Phase::Idle;
+        Listen();
+    }
+
+    /**
+     * @brief Re-enable address listening if started.
+     *
+     * @note The HAL keeps listening after some errors, the call then returns HAL_BUSY harmlessly.
+     */
+    void Listen() noexcept
+    {
+        if (m_listening) {
+            HAL_I2C_EnableListen_IT(&m_handle);
+        }
+    }
+
+    /**
+     * @brief Copy staged bytes into the register file and notify watchers of changes.
+     */
+    void ApplyWrite() noexcept
+    {
+        if (m_phase != Phase::Writing || m_staged_count == 0) {
+            return;
+        }
+        bool any_changed = false;
+        for (std::size_t i = 0; i < m_staged_count; ++i) {
+            auto& current = m_registers[m_pointer + i];
+            if (current != m_staging[i]) {
+                current = m_staging[i];
+                m_changed[m_pointer + i] = true;
+                any_changed = true;
+            }
+        }
+        m_staged_count = 0;
+        if (!any_changed) {
+            return;
+        }
+        for (std::size_t w = 0; w < m_watcher_count; ++w) {
+            const auto& watcher = m_watchers[w];
+            const auto begin = m_changed.begin() + watcher.first;
+            if (std::find(begin, begin + watcher.count, true) != begin + watcher.count) {
+                watcher.callback();
+            }
+        }
+        m_changed.fill(false);
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_I2C_SLAVE_HPP */
@@ -0,0 +1,544 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_ICM42688_HPP
+#define STM32_ICM42688_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "DmaBuffer.hpp"
+#include "Gpio.hpp"
+#include "RegisterMap.hpp"
+
+namespace STM32 {
+
+/**
+ * @enum Icm42688Odr, Output data rates of the accelerometer and gyroscope.
+ */
+enum class Icm42688Odr : std::uint8_t {
+    Hz8000 = 0x03,
+    Hz4000 = 0x04,
+    Hz2000 = 0x05,
+    Hz1000 = 0x06,
+    Hz500 = 0x0F,
+    Hz200 = 0x07,
+    Hz100 = 0x08
+};
+
+/**
+ * @enum Icm42688AccelRange, Full-scale ranges of the accelerometer.
+ */
+enum class Icm42688AccelRange : std::uint8_t {
+    G16 = 0x00,
+    G8 = 0x01,
+    G4 = 0x02,
+    G2 = 0x03
+};
+
+/**
+ * @enum Icm42688GyroRange, Full-scale ranges of the gyroscope.
+ */
+enum class Icm42688GyroRange : std::uint8_t {
+    Dps2000 = 0x00,
+    Dps1000 = 0x01,
+    Dps500 = 0x02,
+    Dps250 = 0x03,
+    Dps125 = 0x04
+};
+
+/**
+ * @struct Icm42688BlockSize, A utility struct to hold the number of samples read per FIFO burst.
+ *
+ * @tparam BlockSizeV   Samples per burst, also the FIFO watermark (1-64, leaves
+ *                      at least half of the FIFO free while a burst is read).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Icm42688.hpp>
+ *
+ * using MyBlock = STM32::Icm42688BlockSize<32>; // 4 ms at 8 kHz
+ * auto size = MyBlock::value; // size is 32.
+ * @endcode
+ */
+template <std::size_t BlockSizeV>
+struct Icm42688BlockSize : __Internal::__Constant<std::size_t, BlockSizeV> {
+    static_assert(
+        BlockSizeV > 0 && BlockSizeV <= 64,
+        "Block size must be between 1 and 64 samples"
+    );
+};
+
+/**
+ * @brief IsIcm42688BlockSize, A concept to check if a type is an Icm42688BlockSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Icm42688.hpp>
+ *
+ * static_assert(STM32::IsIcm42688BlockSize<STM32::Icm42688BlockSize<32>>);
+ * static_assert(!STM32::IsIcm42688BlockSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsIcm42688BlockSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0 && T::value <= 64;
+
+/**
+ * @class Icm42688Block, A block of IMU samples stored as structure of arrays.
+ *
+ * Each axis is a contiguous array of raw two's complement samples, so
+ * filters can run over one channel at a time with sequential loads.
+ *
+ * @tparam BlockSizeT   Maximum number of samples in the block.
+ */
+template <IsIcm42688BlockSize BlockSizeT>
+class Icm42688Block {
+public:
+
+    /**
+     * @returns Number of valid samples in the block.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_size;
+    }
+
+    /**
+     * @returns Raw accelerometer X samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> AccelX() const noexcept
+    {
+        return Channel(m_accel_x);
+    }
+
+    /**
+     * @returns Raw accelerometer Y samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> AccelY() const noexcept
+    {
+        return Channel(m_accel_y);
+    }
+
+    /**
+     * @returns Raw accelerometer Z samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> AccelZ() const noexcept
+    {
+        return Channel(m_accel_z);
+    }
+
+    /**
+     * @returns Raw gyroscope X samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> GyroX() const noexcept
+    {
+        return Channel(m_gyro_x);
+    }
+
+    /**
+     * @returns Raw gyroscope Y samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> GyroY() const noexcept
+    {
+        return Channel(m_gyro_y);
+    }
+
+    /**
+     * @returns Raw gyroscope Z samples.
+     */
+    [[nodiscard]]
+    std::span<const std::int16_t> GyroZ() const noexcept
+    {
+        return Channel(m_gyro_z);
+    }
+
+    /**
+     * @returns Raw FIFO temperature samples (degC = value / 2.07 + 25).
+     */
+    [[nodiscard]]
+    std::span<const std::int8_t> Temperature() const noexcept
+    {
+        return Channel(m_temperature);
+    }
+
+    /**
+     * @returns Sample timestamps in microseconds, extended from the 16-bit
+     *          FIFO timestamps (wraps after about 71 minutes).
+     */
+    [[nodiscard]]
+    std::span<const std::uint32_t> Timestamp() const noexcept
+    {
+        return Channel(m_timestamp);
+    }
+
+private:
+    template <IsAsyncRegisterBus, IsIcm42688BlockSize>
+    friend class Icm42688;
+
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_accel_x{};
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_accel_y{};
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_accel_z{};
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_gyro_x{};
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_gyro_y{};
+    alignas(8) std::array<std::int16_t, BlockSizeT::value> m_gyro_z{};
+    alignas(8) std::array<std::int8_t, BlockSizeT::value> m_temperature{};
+    alignas(8) std::array<std::uint32_t, BlockSizeT::value> m_timestamp{};
+    std::size_t m_size{0};
+
+    /**
+     * @returns View of the valid part of a channel.
+     */
+    template <typename T>
+    std::span<const T> Channel(const std::array<T, BlockSizeT::value>& channel) const noexcept
+    {
+        return std::span<const T>{channel.data(), m_size};
+    }
+};
+
+/**
+ * @class Icm42688, FIFO watermark driven ICM-42688-P IMU acquisition over I2C or SPI DMA.
+ *
+ * The device buffers accelerometer, gyroscope, temperature and timestamp
+ * packets in its FIFO and raises INT1 once a block worth of samples is
+ * stored. The interrupt starts a single DMA burst read of the whole block
+ * from FIFO_DATA; its completion unpacks the packets into the active block of
+ * a double buffer and invokes the block-ready callback. The CPU runs one
+ * interrupt pair per block instead of per sample, which sustains the full
+ * 8 kHz output data rate.
+ *
+ * If the application has not released the ready block when the next block is
+ * full, that block is dropped and counted. While the FIFO stays above the
+ * watermark INT1 is raised again on every sample, so a burst missed because
+ * the bus was busy is read on the next one.
+ *
+ * @tparam BusT         Register bus (I2cRegisterBus or SpiRegisterBus with read flag 0x80).
+ * @tparam BlockSizeT   Samples per block (e.g., Icm42688BlockSize<32>).
+ *
+ * @note Icm42688 class is non-copyable and non-movable.
+ * @note INT1 is configured as pulsed active high push-pull, the EXTI pin must
+ *       trigger on the rising edge.
+ * @note Start() configures the device in blocking mode.
+ * @note The block-ready callback is invoked in interrupt context.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Icm42688.hpp>
+ *
+ * SPI_HandleTypeDef hspi1; // Assume properly initialized with DMA by CubeMX
+ *
+ * extern "C" void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterrupt::Dispatch(GPIO_Pin);
+ * }
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi1};
+ * STM32::GpioOutput cs{GPIOA, GPIO_PIN_4};
+ * STM32::GpioInterrupt int1{GPIOB, GPIO_PIN_0}; // EXTI rising edge
+ * STM32::SpiRegisterBus bus{spi, cs};
+ *
+ * STM32::Icm42688<decltype(bus), STM32::Icm42688BlockSize<32>> imu{bus, int1};
+ *
+ * imu.Start(STM32::Icm42688Odr::Hz8000, STM32::Icm42688AccelRange::G4,
+ *           STM32::Icm42688GyroRange::Dps1000, [](){
+ *     // Block ready, called in interrupt context
+ * });
+ *
+ * while (true) {
+ *     if (const auto* block = imu.GetReadyBlock()) {
+ *         for (auto gz : block->GyroZ()) {
+ *             // filter gz
+ *         }
+ *         imu.ReleaseBlock();
+ *     }
+ * }
+ * @endcode
+ */
+template <IsAsyncRegisterBus BusT, IsIcm42688BlockSize BlockSizeT>
+class Icm42688 {
+    enum Register : std::uint16_t {
+        IntConfig = 0x14,
+        FifoConfig = 0x16,
+        FifoData = 0x30,
+        SignalPathReset = 0x4B,
+        IntfConfig0 = 0x4C,
+        PwrMgmt0 = 0x4E,
+        GyroConfig0 = 0x4F,
+        AccelConfig0 = 0x50,
+        TmstConfig = 0x54,
+        FifoConfig1 = 0x5F,
+        FifoConfig2 = 0x60,
+        IntConfig1 = 0x64,
+        IntSource0 = 0x65,
+        WhoAmI = 0x75
+    };
+
+    static constexpr std::uint8_t who_am_i{0x47};
+    static constexpr std::size_t packet_size{16};
+    static constexpr std::uint8_t header_empty{0x80};
+    static constexpr std::uint8_t header_accel_gyro{0x60};
+public:
+    using BlockT = Icm42688Block<BlockSizeT>;
+
+    /**
+     * @brief Construct Icm42688 class.
+     *
+     * @param bus           Reference to the register bus connected to the IMU.
+     * @param interrupt     Reference to the EXTI pin connected to INT1.
+     */
+    Icm42688(BusT& bus, GpioInterrupt& interrupt) noexcept
+      : m_bus{bus}, m_interrupt{interrupt}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Icm42688(const Icm42688&) = delete;
+    Icm42688& operator=(const Icm42688&) = delete;
+    Icm42688(Icm42688&&) = delete;
+    Icm42688& operator=(Icm42688&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Icm42688 class, stops acquisition.
+     */
+    ~Icm42688()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Configure the sensors and the FIFO, then start acquisition.
+     *
+     * @param odr                   Output data rate of both sensors.
+     * @param accel_range           Accelerometer full-scale range.
+     * @param gyro_range            Gyroscope full-scale range.
+     * @param block_ready_callback  Callback function to be called when a block is ready.
+     *
+     * @returns True on success, false if the device did not respond or is not an ICM-42688.
+     */
+    bool Start(
+        Icm42688Odr odr,
+        Icm42688AccelRange accel_range,
+        Icm42688GyroRange gyro_range,
+        CallbackT&& block_ready_callback = [](){}
+    ) noexcept
+    {
+        Stop();
+        std::array<std::uint8_t, 1> identity{};
+        if (!m_bus.Read(WhoAmI, identity) || identity[0] != who_am_i) {
+            return false;
+        }
+        const auto odr_bits = static_cast<std::uint8_t>(odr);
+        const bool configured =
+            WriteRegister(PwrMgmt0, 0x00) &&                /* Sensors off while configuring */
+            WriteRegister(IntfConfig0, 0x70) &&             /* FIFO count in records, big endian */
+            WriteRegister(IntConfig, 0x03) &&               /* INT1 pulsed, push-pull, active high */
+            WriteRegister(IntConfig1, IntConfig1Value(odr)) &&  /* INT1 pulse timing for the ODR */
+            WriteRegister(TmstConfig, 0x21) &&              /* Timestamp enabled, 1 us resolution */
+            WriteRegister(GyroConfig0, static_cast<std::uint8_t>(
+                (static_cast<std::uint8_t>(gyro_range) << 5) | odr_bits
+            )) &&
+            WriteRegister(AccelConfig0, static_cast<std::uint8_t>(
+                (static_cast<std::uint8_t>(accel_range) << 5) | odr_bits
+            )) &&
+            WriteRegister(FifoConfig1, 0x2F) &&             /* Accel, gyro, temp, timestamp; WM on every record above */
+            m_bus.Write(FifoConfig2, std::array<std::uint8_t, 2>{
+                static_cast<std::uint8_t>(BlockSizeT::value), 0x00
+            }) &&
+            WriteRegister(FifoConfig, 0x40) &&              /* Stream-to-FIFO */
+            WriteRegister(SignalPathReset, 0x02) &&         /* Flush FIFO */
+            WriteRegister(IntSource0, 0x04) &&              /* FIFO threshold on INT1 */
+            WriteRegister(PwrMgmt0, 0x0F);                  /* Accel and gyro low-noise mode */
+        if (!configured) {
+            return false;
+        }
+        m_block_ready_callback = std::move(block_ready_callback);
+        m_active_block = 0;
+        m_first_sample = true;
+        m_ready_block.store(no_block, std::memory_order_release);
+        m_busy.store(false, std::memory_order_release);
+        m_interrupt.Enable([this](){
+            OnWatermark();
+        });
+        return true;
+    }
+
+    /**
+     * @brief Stop acquisition, the device keeps sampling into its FIFO.
+     *
+     * @note A burst in progress completes and is delivered.
+     */
+    void Stop() noexcept
+    {
+        m_interrupt.Disable();
+    }
+
+    /**
+     * @returns Pointer to the block ready for processing, nullptr if none.
+     */
+    [[nodiscard]]
+    const BlockT* GetReadyBlock() const noexcept
+    {
+        const auto index = m_ready_block.load(std::memory_order_acquire);
+        return (index == no_block) ? nullptr : &m_blocks[index];
+    }
+
+    /**
+     * @brief Hand the ready block back for acquisition.
+     */
+    void ReleaseBlock() noexcept
+    {
+        m_ready_block.store(no_block, std::memory_order_release);
+    }
+
+    /**
+     * @returns Number of blocks dropped because the ready block was not released in time.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedBlockCount() const noexcept
+    {
+        return m_dropped_blocks.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns Number of bursts that failed to start or ended with a bus error.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_error_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t no_block{2};
+
+    BusT& m_bus;
+    GpioInterrupt& m_interrupt;
+    CallbackT m_block_ready_callback{};
+    DmaBuffer<std::uint8_t, BusT::read_offset + packet_size * BlockSizeT::value> m_burst{};
+    std::array<BlockT, 2> m_blocks{};
+    std::size_t m_active_block{0};
+    std::uint32_t m_time{0};
+    std::uint16_t m_last_timestamp{0};
+    bool m_first_sample{true};
+    std::atomic<std::size_t> m_ready_block{no_block};
+    std::atomic<bool> m_busy{false};
+    std::atomic<std::uint32_t> m_dropped_blocks{0};
+    std::atomic<std::uint32_t> m_error_count{0};
+
+    /**
+     * @brief Write a single register in blocking mode.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool WriteRegister(Register address, std::uint8_t value) noexcept
+    {
+        return m_bus.Write(address, std::array<std::uint8_t, 1>{value});
+    }
+
+    /**
+     * @returns INT_CONFIG1 value, INT_ASYNC_RESET is always cleared for INT1 operation.
+     *
+     * @note The short 8 us pulse without deassertion delay is required at 4 kHz and above.
+     */
+    static constexpr std::uint8_t IntConfig1Value(Icm42688Odr odr) noexcept
+    {
+        return (odr == Icm42688Odr::Hz8000 || odr == Icm42688Odr::Hz4000) ? 0x60 : 0x00;
+    }
+
+    /**
+     * @returns Big-endian 16-bit value.
+     */
+    static constexpr std::uint16_t BigEndian(const std::uint8_t* bytes) noexcept
+    {
+        return static_cast<std::uint16_t>((bytes[0] << 8) | bytes[1]);
+    }
+
+    /**
+     * @brief Start reading a block of packets from the FIFO.
+     */
+    void OnWatermark() noexcept
+    {
+        if (m_busy.load(std::memory_order_acquire)) {
+            return;
+        }
+        m_busy.store(true, std::memory_order_release);
+        const bool started = m_bus.ReadTo(FifoData, m_burst.Span(), [this](){
+            OnBurstComplete();
+        });
+        if (!started) {
+            m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+            m_busy.store(false, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Unpack the packets into the active block and hand it over.
+     *
+     * A burst that ended with a bus error is discarded and counted. Unpacking
+     * stops at the first packet that is not an accel and gyro packet (empty
+     * FIFO marker).
+     */
+    void OnBurstComplete() noexcept
+    {
+        if (!m_bus.LastReadSucceeded()) {
+            m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+            m_busy.store(false, std::memory_order_release);
+            return;
+        }
+        auto& block = m_blocks[m_active_block];
+        std::size_t size = 0;
+        for (; size < BlockSizeT::value; ++size) {
+            const std::uint8_t* packet = m_burst.data() + BusT::read_offset + size * packet_size;
+            if ((packet[0] & header_empty) || (packet[0] & header_accel_gyro) != header_accel_gyro) {
+                break;
+            }
+            block.m_accel_x[size] = static_cast<std::int16_t>(BigEndian(packet + 1));
+            block.m_accel_y[size] = static_cast<std::int16_t>(BigEndian(packet + 3));
+            block.m_accel_z[size] = static_cast<std::int16_t>(BigEndian(packet + 5));
+            block.m_gyro_x[size] = static_cast<std::int16_t>(BigEndian(packet + 7));
+            block.m_gyro_y[size] = static_cast<std::int16_t>(BigEndian(packet + 9));
+            block.m_gyro_z[size] = static_cast<std::int16_t>(BigEndian(packet + 11));
+            block.m_temperature[size] = static_cast<std::int8_t>(packet[13]);
+            const auto timestamp = BigEndian(packet + 14);
+            m_time = m_first_sample ?
+                timestamp : m_time + static_cast<std::uint16_t>(timestamp - m_last_timestamp);
+            m_last_timestamp = timestamp;
+            m_first_sample = false;
+            block.m_timestamp[size] = m_time;
+        }
+        block.m_size = size;
+        m_busy.store(false, std::memory_order_release);
+        if (size == 0) {
+            return;
+        }
+        if (m_ready_block.load(std::memory_order_acquire) != no_block) {
+            m_dropped_blocks.store(GetDroppedBlockCount() + 1, std::memory_order_relaxed);
+            return;
+        }
+        m_ready_block.store(m_active_block, std::memory_order_release);
+        m_active_block ^= 1;
+        if (m_block_ready_callback) {
+            m_block_ready_callback();
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_ICM42688_HPP */
@@ -0,0 +1,645 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_MCP23017_HPP
+#define STM32_MCP23017_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "DmaBuffer.hpp"
+#include "Gpio.hpp"
+#include "I2c.hpp"
+
+namespace STM32 {
+
+/**
+ * @class Mcp23017, Interrupt-driven MCP23017 16-bit I/O expander over I2C DMA.
+ *
+ * Inputs are not polled: the expander's INT output is wired to an EXTI pin
+ * and every change of an input pin starts a single DMA read of the GPIO
+ * registers, which also clears the interrupt on the expander. While inputs
+ * are idle the driver generates no bus traffic. Outputs are kept in a cached
+ * copy of the output latch, so writing a pin is one register write of both
+ * OLAT registers, and writes that do not change the latch are skipped.
+ *
+ * Pin 0-7 are GPA0-GPA7 and pin 8-15 are GPB0-GPB7.
+ *
+ * @tparam I2cT     I2c type (any working mode, transfers always use DMA).
+ *
+ * @note Mcp23017 class is non-copyable and non-movable.
+ * @note The expander uses the bus exclusively, each transfer passes its own
+ *       error callback.
+ * @note The INT pin must be configured for a falling edge interrupt (INT is
+ *       active low push-pull after reset), the driver mirrors INTA and INTB
+ *       so either of them can be used.
+ * @note Outputs must be written from a single context.
+ * @note The change callback is invoked in interrupt context.
+ * @note A failed input read is retried twice (INT stays asserted until the
+ *       inputs are read), a failed output write is not retried. Call Refresh()
+ *       to re-read the inputs and re-send the output latch after bus errors.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Mcp23017.hpp>
+ *
+ * extern "C" void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterrupt::Dispatch(GPIO_Pin);
+ * }
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized with DMA by CubeMX
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::GpioInterrupt expander_int{GPIOB, GPIO_PIN_5};
+ * STM32::Mcp23017<decltype(i2c)> expander{i2c, expander_int, 0x20};
+ *
+ * // GPA0-GPA7 buttons with pull-ups, GPB0-GPB7 LEDs
+ * expander.Start(0x00FF, 0x00FF, [](){
+ *     // An input changed
+ * });
+ *
+ * // Pins with the GpioInput/GpioOutput interface
+ * auto button = expander.Input(0);
+ * auto led = expander.Output(8);
+ *
+ * if (button.IsLow()) {
+ *     led.High();
+ * }
+ * led.Toggle();
+ * led = STM32::GpioPinState::Low;
+ *
+ * // Several outputs in one transaction
+ * expander.WritePort(0xFF00, 0x5500);
+ * @endcode
+ */
+template <IsI2c I2cT>
+class Mcp23017 {
+    enum Register : std::uint16_t {
+        IoDirA = 0x00,
+        GpIntEnA = 0x04,
+        IntConA = 0x08,
+        IoCon = 0x0A,
+        GpPuA = 0x0C,
+        GpioA = 0x12,
+        OLatA = 0x14
+    };
+
+    enum class Operation : std::uint8_t {
+        None,
+        Reading,
+        Writing
+    };
+
+    static constexpr std::uint8_t iocon_mirror{0x40};
+    static constexpr std::size_t max_read_retries{2};
+public:
+
+    /**
+     * @class InputPin, A single expander input with a GpioInput-like interface.
+     *
+     * @note InputPin is a lightweight reference and must not outlive its Mcp23017.
+     */
+    class InputPin {
+    public:
+
+        /**
+         * @brief Construct InputPin class.
+         *
+         * @param expander  Reference to the owning expander.
+         * @param index     Pin index (0-15).
+         */
+        InputPin(Mcp23017& expander, std::size_t index) noexcept
+          : m_expander{expander}, m_index{index}
+        { }
+
+        /**
+         * @returns State of the input as last read from the expander.
+         */
+        [[nodiscard]]
+        GpioPinState Read() const noexcept
+        {
+            return m_expander.Read(m_index);
+        }
+
+        /**
+         * @brief Implicit conversion operator to read the input state.
+         *
+         * @returns State of the input as last read from the expander.
+         */
+        operator GpioPinState() const noexcept
+        {
+            return Read();
+        }
+
+        /**
+         * @returns True if the input is in High state.
+         */
+        [[nodiscard]]
+        bool IsHigh() const noexcept
+        {
+            return Read() == GpioPinState::High;
+        }
+
+        /**
+         * @returns True if the input is in Low state.
+         */
+        [[nodiscard]]
+        bool IsLow() const noexcept
+        {
+            return Read() == GpioPinState::Low;
+        }
+
+    private:
+        Mcp23017& m_expander;
+        std::size_t m_index;
+    };
+
+    /**
+     * @class OutputPin, A single expander output with a GpioOutput-like interface.
+     *
+     * @note OutputPin is a lightweight reference and must not outlive its Mcp23017.
+     */
+    class OutputPin {
+    public:
+
+        /**
+         * @brief Construct OutputPin class.
+         *
+         * @param expander  Reference to the owning expander.
+         * @param index     Pin index (0-15).
+         */
+        OutputPin(Mcp23017& expander, std::size_t index) noexcept
+          : m_expander{expander}, m_index{index}
+        { }
+
+        /**
+         * @brief Write the output state.
+         *
+         * @param pin_state     State to write to the output.
+         */
+        void Write(GpioPinState pin_state) noexcept
+        {
+            m_expander.Write(m_index, pin_state);
+        }
+
+        /**
+         * @brief Assignment operator to write the output state.
+         *
+         * @param state     State to write to the output.
+         *
+         * @returns Reference to the current OutputPin object.
+         */
+        OutputPin& operator=(GpioPinState state) noexcept
+        {
+            Write(state);
+            return *this;
+        }
+
+        /**
+         * @brief Set the output to High state.
+         */
+        void High() noexcept
+        {
+            Write(GpioPinState::High);
+        }
+
+        /**
+         * @brief Set the output to Low state.
+         */
+        void Low() noexcept
+        {
+            Write(GpioPinState::Low);
+        }
+
+        /**
+         * @brief Toggle the output state.
+         */
+        void Toggle() noexcept
+        {
+            m_expander.Toggle(m_index);
+        }
+
+        /**
+         * @returns State of the output in the cached latch.
+         */
+        [[nodiscard]]
+        GpioPinState Read() const noexcept
+        {
+            return m_expander.ReadOutput(m_index);
+        }
+
+    private:
+        Mcp23017& m_expander;
+        std::size_t m_index;
+    };
+
+    /**
+     * @brief Construct Mcp23017 class.
+     *
+     * @param i2c               Reference to the I2c connected to the expander.
+     * @param interrupt         Reference to the GpioInterrupt connected to INTA or INTB.
+     * @param device_address    7-bit I2C device address (0x20-0x27).
+     *
+     * @note All outputs start low, the expander is not accessed until Start() is called.
+     */
+    Mcp23017(I2cT& i2c, GpioInterrupt& interrupt, std::uint16_t device_address) noexcept
+      : m_i2c{i2c}, m_interrupt{interrupt}, m_device_address{device_address}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Mcp23017(const Mcp23017&) = delete;
+    Mcp23017& operator=(const Mcp23017&) = delete;
+    Mcp23017(Mcp23017&&) = delete;
+    Mcp23017& operator=(Mcp23017&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Mcp23017 class, stops reacting to the interrupt.
+     */
+    ~Mcp23017()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Configure the expander and start reacting to input changes.
+     *
+     * Writes the cached output latch before the pin directions so outputs do
+     * not glitch and enables interrupt-on-change for every input. The MCU
+     * interrupt is enabled before the initial input read clears INT, so no
+     * change is missed in between. The configuration is done in blocking mode.
+     *
+     * @param input_mask        Pins configured as inputs (bit n is pin n), others are outputs.
+     * @param pull_up_mask      Inputs with the internal 100k pull-up enabled (default is none).
+     * @param change_callback   Callback function to be called when an input changed.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start(
+        std::uint16_t input_mask,
+        std::uint16_t pull_up_mask = 0,
+        CallbackT&& change_callback = [](){}
+    ) noexcept
+    {
+        Stop();
+        m_input_mask = input_mask;
+        m_change_callback = std::move(change_callback);
+        const std::array<std::uint8_t, 1> iocon{iocon_mirror};
+        const std::array<std::uint8_t, 2> no_compare{};
+        const bool configured =
+            WriteRegister(IoCon, iocon) &&
+            WriteRegister(OLatA, Split(m_latch.load(std::memory_order_relaxed))) &&
+            WriteRegister(IoDirA, Split(input_mask)) &&
+            WriteRegister(GpPuA, Split(pull_up_mask)) &&
+            WriteRegister(IntConA, no_compare) &&
+            WriteRegister(GpIntEnA, Split(input_mask));
+        if (!configured) {
+            return false;
+        }
+        m_read_retries = 0;
+        /* Hold the bus: an interrupt during the initial read only marks a read pending */
+        m_operation.store(Operation::Reading, std::memory_order_release);
+        m_interrupt.Enable([this](){
+            m_read_pending.store(true, std::memory_order_release);
+            Service();
+        });
+        std::array<std::uint8_t, 2> gpio{};
+        bool read{false};
+        for (std::size_t attempt = 0; attempt <= max_read_retries && !read; ++attempt) {
+            read = m_i2c.template MemoryReadTo<WorkingMode::Blocking>(
+                m_device_address, GpioA, I2cMemoryAddressSize::Bits8, gpio
+            );
+        }
+        if (!read) {
+            Stop();
+            m_operation.store(Operation::None, std::memory_order_release);
+            return false;
+        }
+        m_inputs.store(Join(gpio), std::memory_order_release);
+        m_operation.store(Operation::None, std::memory_order_release);
+        Service();
+        return true;
+    }
+
+    /**
+     * @brief Stop reacting to input changes.
+     *
+     * @note A transfer in progress still completes, the expander configuration is kept.
+     */
+    void Stop() noexcept
+    {
+        m_interrupt.Disable();
+    }
+
+    /**
+     * @brief Access an input without bounds checking.
+     *
+     * @param index     Pin index (0-15).
+     *
+     * @returns InputPin proxy.
+     */
+    [[nodiscard]]
+    InputPin Input(std::size_t index) noexcept
+    {
+        return InputPin{*this, index};
+    }
+
+    /**
+     * @brief Access an output without bounds checking.
+     *
+     * @param index     Pin index (0-15).
+     *
+     * @returns OutputPin proxy.
+     */
+    [[nodiscard]]
+    OutputPin Output(std::size_t index) noexcept
+    {
+        return OutputPin{*this, index};
+    }
+
+    /**
+     * @brief Read an input state from the last read of the expander.
+     *
+     * @param index     Pin index (unchecked).
+     *
+     * @returns State of the pin.
+     */
+    [[nodiscard]]
+    GpioPinState Read(std::size_t index) const noexcept
+    {
+        return ((ReadPort() >> index) & 1U) ? GpioPinState::High : GpioPinState::Low;
+    }
+
+    /**
+     * @returns State of all pins from the last read of the expander (bit n is pin n).
+     */
+    [[nodiscard]]
+    std::uint16_t ReadPort() const noexcept
+    {
+        return m_inputs.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Read an output state from the cached latch.
+     *
+     * @param index     Pin index (unchecked).
+     *
+     * @returns State of the output, as last written.
+     */
+    [[nodiscard]]
+    GpioPinState ReadOutput(std::size_t index) const noexcept
+    {
+        return ((m_latch.load(std::memory_order_relaxed) >> index) & 1U) ?
+            GpioPinState::High : GpioPinState::Low;
+    }
+
+    /**
+     * @brief Write an output state.
+     *
+     * @param index         Pin index (unchecked).
+     * @param pin_state     State to write to the output.
+     *
+     * @returns True if the latch is up to date or being written, false on I2C error.
+     */
+    bool Write(std::size_t index, GpioPinState pin_state) noexcept
+    {
+        const auto mask = static_cast<std::uint16_t>(1U << index);
+        return WritePort(mask, pin_state == GpioPinState::High ? mask : 0);
+    }
+
+    /**
+     * @brief Toggle an output state.
+     *
+     * @param index     Pin index (unchecked).
+     *
+     * @returns True if the latch is being written, false on I2C error.
+     */
+    bool Toggle(std::size_t index) noexcept
+    {
+        const auto mask = static_cast<std::uint16_t>(1U << index);
+        return WritePort(mask, static_cast<std::uint16_t>(~m_latch.load(std::memory_order_relaxed)));
+    }
+
+    /**
+     * @brief Write several outputs in a single transaction.
+     *
+     * If a transfer is in progress, the latch is written as soon as it completes.
+     *
+     * @param mask      Outputs to be written (bit n is pin n).
+     * @param value     New states of the outputs selected by mask.
+     *
+     * @returns True if the latch is up to date or being written, false on I2C error.
+     */
+    bool WritePort(std::uint16_t mask, std::uint16_t value) noexcept
+    {
+        const auto latch = m_latch.load(std::memory_order_relaxed);
+        const auto updated = static_cast<std::uint16_t>((latch & ~mask) | (value & mask));
+        if (updated == latch) {
+            return true;
+        }
+        m_latch.store(updated, std::memory_order_relaxed);
+        m_write_pending.store(true, std::memory_order_release);
+        return Service();
+    }
+
+    /**
+     * @brief Re-read the inputs and re-send the output latch.
+     *
+     * Useful to recover after a bus error or to restore outputs after
+     * electrical disturbances.
+     *
+     * @returns True if the transfers are in progress or queued, false on I2C error.
+     */
+    bool Refresh() noexcept
+    {
+        m_write_pending.store(true, std::memory_order_release);
+        m_read_pending.store(true, std::memory_order_release);
+        return Service();
+    }
+
+    /**
+     * @returns True if a transfer is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_operation.load(std::memory_order_acquire) != Operation::None;
+    }
+
+    /**
+     * @returns Number of transfers that failed to start or ended with a bus error.
+     */
+    [[nodiscard]]
+    std::uint32_t GetErrorCount() const noexcept
+    {
+        return m_error_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    I2cT& m_i2c;
+    GpioInterrupt& m_interrupt;
+    std::uint16_t m_device_address;
+    std::uint16_t m_input_mask{0};
+    CallbackT m_change_callback{};
+    DmaBuffer<std::uint8_t, 2> m_transmit_buffer{};
+    DmaBuffer<std::uint8_t, 2> m_receive_buffer{};
+    std::atomic<std::uint16_t> m_latch{0};
+    std::atomic<std::uint16_t> m_inputs{0};
+    std::atomic<Operation> m_operation{Operation::None};
+    std::atomic<bool> m_write_pending{false};
+    std::atomic<bool> m_read_pending{false};
+    std::atomic<std::uint32_t> m_error_count{0};
+    std::size_t m_read_retries{0};
+
+    /**
+     * @returns Port A and port B bytes of a 16-bit pin mask.
+     */
+    static constexpr std::array<std::uint8_t, 2> Split(std::uint16_t value) noexcept
+    {
+        return {
+            static_cast<std::uint8_t>(value & 0xFFU),
+            static_cast<std::uint8_t>(value >> 8)
+        };
+    }
+
+    /**
+     * @returns 16-bit pin mask of port A and port B bytes.
+     */
+    static constexpr std::uint16_t Join(const auto& bytes) noexcept
+    {
+        return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+    }
+
+    /**
+     * @brief Write a register pair in blocking mode.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool WriteRegister(Register address, const auto& bytes) noexcept
+    {
+        return m_i2c.template MemoryWrite<WorkingMode::Blocking>(
+            m_device_address, address, I2cMemoryAddressSize::Bits8, bytes
+        );
+    }
+
+    /**
+     * @brief Start the next pending transfer if the bus is free.
+     *
+     * A pending latch write is served before a pending input read.
+     *
+     * @returns True if nothing failed to start, false otherwise.
+     */
+    bool Service() noexcept
+    {
+        Operation operation{Operation::None};
+        {
+            __Internal::__CriticalSection guard{};
+            if (IsBusy()) {
+                return true;
+            }
+            if (m_write_pending.load(std::memory_order_acquire)) {
+                m_write_pending.store(false, std::memory_order_relaxed);
+                operation = Operation::Writing;
+            } else if (m_read_pending.load(std::memory_order_acquire)) {
+                m_read_pending.store(false, std::memory_order_relaxed);
+                operation = Operation::Reading;
+            } else {
+                return true;
+            }
+            m_operation.store(operation, std::memory_order_release);
+        }
+        const bool started = (operation == Operation::Writing) ? StartWrite() : StartRead();
+        if (!started) {
+            m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+            if (operation == Operation::Writing) {
+                m_write_pending.store(true, std::memory_order_release);
+            } else {
+                m_read_pending.store(true, std::memory_order_release);
+            }
+            m_operation.store(Operation::None, std::memory_order_release);
+        }
+        return started;
+    }
+
+    /**
+     * @brief Copy the cached latch to the DMA buffer and start writing OLATA/OLATB.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartWrite() noexcept
+    {
+        const auto latch = Split(m_latch.load(std::memory_order_relaxed));
+        m_transmit_buffer[0] = latch[0];
+        m_transmit_buffer[1] = latch[1];
+        return m_i2c.template MemoryWrite<WorkingMode::DMA>(
+            m_device_address, OLatA, I2cMemoryAddressSize::Bits8, m_transmit_buffer,
+            [this](){
+                m_operation.store(Operation::None, std::memory_order_release);
+                Service();
+            },
+            [this](){
+                OnTransferFailed(Operation::Writing);
+            }
+        );
+    }
+
+    /**
+     * @brief Start reading GPIOA/GPIOB, which clears the expander interrupt.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartRead() noexcept
+    {
+        return m_i2c.template MemoryReadTo<WorkingMode::DMA>(
+            m_device_address, GpioA, I2cMemoryAddressSize::Bits8, m_receive_buffer,
+            [this](){
+                OnReadComplete();
+            },
+            [this](){
+                OnTransferFailed(Operation::Reading);
+            }
+        );
+    }
+
+    /**
+     * @brief Publish the new input state, serve pending transfers and report changes.
+     */
+    void OnReadComplete() noexcept
+    {
+        m_read_retries = 0;
+        const auto inputs = Join(m_receive_buffer);
+        const auto previous = m_inputs.load(std::memory_order_relaxed);
+        m_inputs.store(inputs, std::memory_order_release);
+        m_operation.store(Operation::None, std::memory_order_release);
+        Service();
+        if ((inputs ^ previous) & m_input_mask) {
+            m_change_callback();
+        }
+    }
+
+    /**
+     * @brief Count a failed transfer and serve the pending ones.
+     *
+     * INT stays asserted until the inputs are read, so no new edge would
+     * request a failed read again; it is retried up to max_read_retries times.
+     */
+    void OnTransferFailed(Operation operation) noexcept
+    {
+        m_error_count.store(GetErrorCount() + 1, std::memory_order_relaxed);
+        if (operation == Operation::Reading && m_read_retries++ < max_read_retries) {
+            m_read_pending.store(true, std::memory_order_release);
+        }
+        m_operation.store(Operation::None, std::memory_order_release);
+        Service();
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_MCP23017_HPP */
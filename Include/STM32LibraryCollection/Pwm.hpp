@@ -6,8 +6,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <concepts>
 #include <cstdint>
+#include <numeric>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 #include "__Internal/__Utility.hpp"
 
@@ -309,6 +313,38 @@ public:
      * @brief Set the PWM duty cycle based on the input value.
      * 
      * @param input     Input value to set the PWM duty cycle.
+     *
+     * @note Uses integer fixed-point arithmetic when the duty cycle range has
+     *       at most 8 binary fraction bits (e.g., 2.5, 12.25), floating point otherwise.
+     * @note Both overloads truncate the exact compare value, so Set(29) and
+     *       Set(29.0) give the same duty cycle.
+     */
+    void Set(std::integral auto input) noexcept
+    {
+        constexpr auto min_value = PwmConfigT::InputRangeT::min_value;
+        constexpr auto max_value = PwmConfigT::InputRangeT::max_value;
+        if constexpr (integer_scaling) {
+            const std::uint32_t clamped{
+                std::cmp_less(input, min_value) ? min_value :
+                std::cmp_greater(input, max_value) ? max_value :
+                static_cast<std::uint32_t>(input)
+            };
+            __HAL_TIM_SET_COMPARE(
+                &m_timer_handle,
+                m_timer_channel,
+                static_cast<std::uint32_t>(
+                    m_pwm_scale.Apply(clamped - PwmConfigT::InputRangeMaxT::min_value)
+                )
+            );
+        } else {
+            Set(static_cast<double>(input));
+        }
+    }
+
+    /**
+     * @brief Set the PWM duty cycle based on a fractional input value.
+     * 
+     * @param input     Input value to set the PWM duty cycle.
      */
     void Set(double input) noexcept
     {
@@ -326,37 +362,168 @@ public:
     }
 
 private:
+    using DutyCycleRangeT = typename PwmConfigT::DutyCycleRangeT;
+    using InputRangeMaxT = typename PwmConfigT::InputRangeMaxT;
+
+    static constexpr std::uint32_t duty_fraction_bits{std::max(
+        __Internal::__FractionBits(DutyCycleRangeT::min_value, 8),
+        __Internal::__FractionBits(DutyCycleRangeT::max_value, 8)
+    )};
+
+    /**
+     * @brief Conversions of integral inputs use integer fixed-point arithmetic
+     *        when the duty cycle range is an exact binary fraction and the
+     *        input range is small enough for an exact 31-bit fraction.
+     */
+    static constexpr bool integer_scaling{
+        duty_fraction_bits <= 8 &&
+        __Internal::__FixedPointScale::Fits(
+            std::uint64_t{InputRangeMaxT::range_size} * (100U << duty_fraction_bits),
+            InputRangeMaxT::range_size,
+            __Internal::__FixedPointRounding::Down
+        )
+    };
+
+    /**
+     * @brief Duty cycle range in units of 1 / (100 * 2^duty_fraction_bits).
+     * @{
+     */
+    static constexpr std::uint64_t duty_denominator{
+        integer_scaling ? (std::uint64_t{100} << duty_fraction_bits) : 1
+    };
+    static constexpr std::uint64_t duty_min{
+        integer_scaling ?
+            static_cast<std::uint64_t>(DutyCycleRangeT::min_value * (1U << duty_fraction_bits)) : 0
+    };
+    static constexpr std::uint64_t duty_max{
+        integer_scaling ?
+            static_cast<std::uint64_t>(DutyCycleRangeT::max_value * (1U << duty_fraction_bits)) : 0
+    };
+    /** @} */
+
+    using PwmScaleT = std::conditional_t<
+        integer_scaling, __Internal::__FixedPointScale, std::monostate
+    >;
+
+    /**
+     * @struct InputScale, Precomputed compare to input value scaling.
+     *
+     * Compare values from compare_min up to the timer resolution are scaled by
+     * a multiply and a shift. Scalings that do not fit fall back to an integer division.
+     */
+    struct InputScale {
+        std::uint32_t compare_min{};
+        bool fits{};
+        __Internal::__FixedPointScale scale{};
+    };
+
+    using InputScaleT = std::conditional_t<
+        integer_scaling, InputScale, std::monostate
+    >;
+
     TIM_HandleTypeDef& m_timer_handle;
     std::uint32_t m_timer_channel;
     std::uint32_t m_pwm_resolution{
         m_timer_handle.Init.Period + 1
     };
-    double m_min_pwm_value{
-        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::min_value) / 100.
+    [[no_unique_address]] PwmScaleT m_pwm_scale{
+        MakePwmScale(m_pwm_resolution)
     };
-    double m_max_pwm_value{
-        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::max_value) / 100.
-    };
-    double m_pwm_value_resolution{
-        m_max_pwm_value - m_min_pwm_value
+    [[no_unique_address]] InputScaleT m_input_scale{
+        MakeInputScale(m_pwm_resolution)
     };
 
+    /**
+     * @brief Precompute the input to compare value scaling for the timer period.
+     *
+     * compare = floor(resolution * (duty_min + input * (duty_max - duty_min) / range) / duty_denominator)
+     *
+     * @param pwm_resolution    Timer period + 1.
+     *
+     * @returns Fixed-point scaling, or std::monostate for the floating point path.
+     */
+    static constexpr PwmScaleT MakePwmScale(std::uint32_t pwm_resolution) noexcept
+    {
+        if constexpr (integer_scaling) {
+            return __Internal::__FixedPointScale::Make(
+                pwm_resolution * (duty_max - duty_min),
+                pwm_resolution * duty_min * InputRangeMaxT::range_size,
+                InputRangeMaxT::range_size * duty_denominator,
+                InputRangeMaxT::range_size,
+                __Internal::__FixedPointRounding::Down
+            );
+        } else {
+            return {};
+        }
+    }
+
+    /**
+     * @brief Precompute the compare value to input scaling for the timer period.
+     *
+     * input = round((compare * duty_denominator - resolution * duty_min) * range / (resolution * (duty_max - duty_min)))
+     *
+     * The scaling starts at compare_min, the first compare value at or above
+     * the duty cycle minimum, so the offset stays non-negative. Common factors
+     * are cancelled first, which keeps the usual servo and LED configurations
+     * well inside the exact fixed-point range.
+     *
+     * @param pwm_resolution    Timer period + 1.
+     *
+     * @returns Compare value scaling, or std::monostate for the floating point path.
+     */
+    static constexpr InputScaleT MakeInputScale(std::uint32_t pwm_resolution) noexcept
+    {
+        if constexpr (integer_scaling) {
+            const std::uint64_t scaled_min{pwm_resolution * duty_min};
+            const std::uint64_t compare_min{(scaled_min + duty_denominator - 1) / duty_denominator};
+            const std::uint64_t numerator{duty_denominator * InputRangeMaxT::range_size};
+            const std::uint64_t offset_numerator{
+                (compare_min * duty_denominator - scaled_min) * InputRangeMaxT::range_size
+            };
+            const std::uint64_t denominator{pwm_resolution * (duty_max - duty_min)};
+            const std::uint64_t divisor{std::gcd(std::gcd(numerator, offset_numerator), denominator)};
+            const std::uint64_t input_max{pwm_resolution - compare_min};
+            InputScale input_scale{
+                static_cast<std::uint32_t>(compare_min),
+                __Internal::__FixedPointScale::Fits(
+                    denominator / divisor, input_max, __Internal::__FixedPointRounding::Nearest
+                )
+            };
+            if (input_scale.fits) {
+                input_scale.scale = __Internal::__FixedPointScale::Make(
+                    numerator / divisor,
+                    offset_numerator / divisor,
+                    denominator / divisor,
+                    input_max,
+                    __Internal::__FixedPointRounding::Nearest
+                );
+            }
+            return input_scale;
+        } else {
+            return {};
+        }
+    }
+
     /**
      * @brief Convert input value to PWM value.
      * 
      * @param input     Input value to convert.
      * 
      * @returns Corresponding PWM value.
+     *
+     * @note Multiplies before dividing, so integral inputs give the same
+     *       compare values as the fixed-point path of Set().
      */
     constexpr auto ConvertToPwm(double input) const noexcept
     {
         return static_cast<std::uint32_t>(
-            m_min_pwm_value +
+            m_pwm_resolution *
             (
-                (input - PwmConfigT::InputRangeMaxT::min_value) / 
-                (PwmConfigT::InputRangeMaxT::range_size)
-            ) *
-            m_pwm_value_resolution
+                DutyCycleRangeT::min_value * InputRangeMaxT::range_size +
+                (input - InputRangeMaxT::min_value) *
+                (DutyCycleRangeT::max_value - DutyCycleRangeT::min_value)
+            ) /
+            (100. * InputRangeMaxT::range_size)
         );
     }
 
@@ -365,15 +532,44 @@ private:
      * 
      * @param pwm_value     PWM value to convert.
      * 
-     * @returns Corresponding input value.
+     * @returns Corresponding input value, rounded to nearest.
+     *
+     * @note The integer path clamps compare values below the duty cycle range
+     *       to the minimum input and above the period to 100% duty. It uses the
+     *       precomputed scaling, or one 64-bit integer division if that does not fit.
      */
-    constexpr auto ConvertToInput(int pwm_value) const noexcept
+    constexpr std::uint32_t ConvertToInput(std::uint32_t pwm_value) const noexcept
     {
-        return static_cast<std::uint32_t>(std::round(
-            (PwmConfigT::InputRangeMaxT::range_size) *
-            ((pwm_value - m_min_pwm_value) / m_pwm_value_resolution)) +
-            PwmConfigT::InputRangeMaxT::min_value
-        );
+        if constexpr (integer_scaling) {
+            if (m_input_scale.fits) {
+                if (pwm_value < m_input_scale.compare_min) {
+                    return InputRangeMaxT::min_value;
+                }
+                const std::uint32_t compare{std::min(pwm_value, m_pwm_resolution)};
+                return static_cast<std::uint32_t>(
+                    m_input_scale.scale.Apply(compare - m_input_scale.compare_min)
+                ) + InputRangeMaxT::min_value;
+            }
+            const std::uint64_t scaled_pwm{std::min(pwm_value, m_pwm_resolution) * duty_denominator};
+            const std::uint64_t scaled_min{m_pwm_resolution * duty_min};
+            const std::uint64_t divisor{m_pwm_resolution * (duty_max - duty_min)};
+            if (scaled_pwm <= scaled_min || divisor == 0) {
+                return InputRangeMaxT::min_value;
+            }
+            const std::uint64_t dividend{(scaled_pwm - scaled_min) * InputRangeMaxT::range_size};
+            const std::uint64_t quotient{dividend / divisor};
+            const std::uint64_t remainder{dividend % divisor};
+            return static_cast<std::uint32_t>(quotient + (remainder >= divisor - remainder)) +
+                   InputRangeMaxT::min_value;
+        } else {
+            const double min_pwm_value{(m_pwm_resolution * DutyCycleRangeT::min_value) / 100.};
+            const double max_pwm_value{(m_pwm_resolution * DutyCycleRangeT::max_value) / 100.};
+            return static_cast<std::uint32_t>(std::round(
+                (InputRangeMaxT::range_size) *
+                ((pwm_value - min_pwm_value) / (max_pwm_value - min_pwm_value))) +
+                InputRangeMaxT::min_value
+            );
+        }
     }
 };
 
@@ -0,0 +1,797 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_REGISTER_MAP_HPP
+#define STM32_REGISTER_MAP_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "DmaBuffer.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if defined(HAL_I2C_MODULE_ENABLED) && (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+#include "I2c.hpp"
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+#if defined(HAL_SPI_MODULE_ENABLED) && (USE_HAL_SPI_REGISTER_CALLBACKS == 1)
+#include "Gpio.hpp"
+#include "Spi.hpp"
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+namespace STM32 {
+
+/**
+ * @enum RegisterAccess, Caching policy of a device register.
+ */
+enum class RegisterAccess {
+    Cached,     /**< Changes only when written by the host (configuration), cached */
+    Volatile    /**< May change on the device side (status, data, commands), never cached */
+};
+
+/**
+ * @struct Register, A compile-time description of a device register.
+ *
+ * @tparam AddressV     Register address.
+ * @tparam WidthV       Width in bytes (1 to 4).
+ * @tparam AccessV      Caching policy (default is RegisterAccess::Cached).
+ * @tparam ResetV       Value after device reset (default is 0).
+ * @tparam ByteOrderV   Byte order on the bus for multi-byte registers (default is big endian).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * using CtrlReg1 = STM32::Register<0x20, 1, STM32::RegisterAccess::Cached, 0x07>;
+ * using OutX = STM32::Register<0x28, 2, STM32::RegisterAccess::Volatile, 0, std::endian::little>;
+ * @endcode
+ */
+template <
+    std::uint16_t AddressV,
+    std::size_t WidthV,
+    RegisterAccess AccessV = RegisterAccess::Cached,
+    std::uint32_t ResetV = 0,
+    std::endian ByteOrderV = std::endian::big
+>
+struct Register {
+    static_assert(
+        WidthV >= 1 && WidthV <= 4,
+        "Register width must be between 1 and 4 bytes"
+    );
+    static_assert(
+        WidthV == 4 || ResetV < (std::uint32_t{1} << (8 * WidthV)),
+        "Reset value exceeds the register width"
+    );
+    using ValueT = std::conditional_t<WidthV == 1, std::uint8_t,
+                   std::conditional_t<WidthV == 2, std::uint16_t, std::uint32_t>>;
+    static constexpr auto address{AddressV};
+    static constexpr auto width{WidthV};
+    static constexpr auto access{AccessV};
+    static constexpr ValueT reset_value{static_cast<ValueT>(ResetV)};
+    static constexpr auto byte_order{ByteOrderV};
+};
+
+/**
+ * @brief IsRegister, A concept to check if a type is a Register.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * static_assert(STM32::IsRegister<STM32::Register<0x20, 1>>);
+ * static_assert(!STM32::IsRegister<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsRegister =
+    requires {
+        typename T::ValueT;
+        { T::address } -> std::convertible_to<std::uint16_t>;
+        { T::width } -> std::convertible_to<std::size_t>;
+        { T::access } -> std::convertible_to<RegisterAccess>;
+        { T::reset_value } -> std::convertible_to<typename T::ValueT>;
+        { T::byte_order } -> std::convertible_to<std::endian>;
+    } &&
+    T::width >= 1 && T::width <= 4;
+
+/**
+ * @brief IsRegisterBus, A concept to check if a type can transfer register bursts.
+ *
+ * A register bus reads or writes consecutive bytes starting at a register
+ * address, relying on the address auto-increment of the device.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * static_assert(STM32::IsRegisterBus<STM32::I2cRegisterBus<MyI2c>>);
+ * static_assert(!STM32::IsRegisterBus<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsRegisterBus = requires(
+    T& bus,
+    std::uint16_t address,
+    std::span<std::uint8_t> rx_message,
+    std::span<const std::uint8_t> tx_message
+) {
+    { bus.Read(address, rx_message) } -> std::same_as<bool>;
+    { bus.Write(address, tx_message) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief IsAsyncRegisterBus, A concept to check if a register bus can read bursts by DMA.
+ *
+ * The register contents are stored read_offset bytes into the buffer, the
+ * bytes before them are used by the bus (e.g., for the SPI header). The
+ * completion callback is also invoked when the transfer ends with a bus
+ * error, so a driver waiting for it never stalls; LastReadSucceeded() tells
+ * the outcome, the data is undefined after an error.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * static_assert(STM32::IsAsyncRegisterBus<STM32::SpiRegisterBus<MySpi>>);
+ * static_assert(!STM32::IsAsyncRegisterBus<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAsyncRegisterBus =
+    IsRegisterBus<T> &&
+    requires(T& bus, std::uint16_t address, DmaSpan<std::uint8_t> rx_message) {
+        { T::read_offset } -> std::convertible_to<std::size_t>;
+        { bus.ReadTo(address, rx_message, [](){}) } -> std::same_as<bool>;
+        { bus.LastReadSucceeded() } -> std::same_as<bool>;
+    };
+
+#if defined(HAL_I2C_MODULE_ENABLED) && (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+/**
+ * @class I2cRegisterBus, Register bus over I2C memory operations.
+ *
+ * @tparam I2cT     I2c type (Read/Write are blocking and ReadTo uses DMA regardless
+ *                  of its working mode).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cRegisterBus bus{i2c, 0x18};
+ * @endcode
+ */
+template <IsI2c I2cT>
+class I2cRegisterBus {
+public:
+    /** Offset of the register contents in the ReadTo buffer */
+    static constexpr std::size_t read_offset{0};
+
+    /**
+     * @brief Construct I2cRegisterBus class.
+     *
+     * @param i2c                   Reference to the I2c.
+     * @param device_address        7-bit I2C device address (0x00-0x7F).
+     * @param memory_address_size   Size of the register address (default is 8-bit).
+     */
+    I2cRegisterBus(
+        I2cT& i2c,
+        std::uint16_t device_address,
+        I2cMemoryAddressSize memory_address_size = I2cMemoryAddressSize::Bits8
+    ) noexcept
+      : m_i2c{i2c}, m_device_address{device_address}, m_memory_address_size{memory_address_size}
+    { }
+
+    /**
+     * @brief Read consecutive registers.
+     *
+     * @param address       First register address.
+     * @param rx_message    Buffer to store the register contents.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Read(std::uint16_t address, std::span<std::uint8_t> rx_message) noexcept
+    {
+        return m_i2c.template MemoryReadTo<WorkingMode::Blocking>(
+            m_device_address, address, m_memory_address_size, rx_message
+        );
+    }
+
+    /**
+     * @brief Write consecutive registers.
+     *
+     * @param address       First register address.
+     * @param tx_message    Register contents to write.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Write(std::uint16_t address, std::span<const std::uint8_t> tx_message) noexcept
+    {
+        return m_i2c.template MemoryWrite<WorkingMode::Blocking>(
+            m_device_address, address, m_memory_address_size, tx_message
+        );
+    }
+
+    /**
+     * @brief Read consecutive registers by DMA.
+     *
+     * @param address           First register address.
+     * @param rx_message        DmaBuffer::Span() to store the register contents.
+     * @param complete_callback Callback function to be called upon completion or bus error.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool ReadTo(
+        std::uint16_t address,
+        DmaSpan<std::uint8_t> rx_message,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        m_read_callback = std::move(complete_callback);
+        return m_i2c.template MemoryReadTo<WorkingMode::DMA>(
+            m_device_address, address, m_memory_address_size, rx_message,
+            [this](){
+                OnReadDone(true);
+            },
+            [this](){
+                OnReadDone(false);
+            }
+        );
+    }
+
+    /**
+     * @returns True if the last ReadTo() completed without a bus error, false otherwise.
+     */
+    [[nodiscard]]
+    bool LastReadSucceeded() const noexcept
+    {
+        return m_read_succeeded;
+    }
+
+private:
+    I2cT& m_i2c;
+    std::uint16_t m_device_address;
+    I2cMemoryAddressSize m_memory_address_size;
+    CallbackT m_read_callback{};
+    bool m_read_succeeded{false};
+
+    /**
+     * @brief Record the outcome of a ReadTo() and invoke its callback.
+     */
+    void OnReadDone(bool succeeded) noexcept
+    {
+        m_read_succeeded = succeeded;
+        m_read_callback();
+    }
+};
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+#if defined(HAL_SPI_MODULE_ENABLED) && (USE_HAL_SPI_REGISTER_CALLBACKS == 1)
+/**
+ * @class SpiRegisterBus, Register bus over SPI with a one-byte address header.
+ *
+ * The header is the register address combined with the read flag for reads
+ * and the burst flag for multi-byte transfers.
+ *
+ * @tparam SpiT     Spi type (Read/Write are blocking and ReadTo uses DMA regardless
+ *                  of its working mode).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi1};
+ * STM32::GpioOutput cs{GPIOA, GPIO_PIN_4};
+ * STM32::SpiRegisterBus bus{spi, cs, 0x80, 0x40}; // LIS3DH: read 0x80, auto-increment 0x40
+ * @endcode
+ */
+template <IsSpi SpiT>
+class SpiRegisterBus {
+public:
+    /** Offset of the register contents in the ReadTo buffer, the header byte comes first */
+    static constexpr std::size_t read_offset{1};
+
+    /**
+     * @brief Construct SpiRegisterBus class.
+     *
+     * @param spi           Reference to the Spi.
+     * @param chip_select   Reference to the GPIO output connected to CS (active low).
+     * @param read_flag     Bits set in the header for reads (default is 0x80).
+     * @param burst_flag    Bits set in the header for multi-byte transfers (default is none).
+     */
+    SpiRegisterBus(
+        SpiT& spi,
+        GpioOutput& chip_select,
+        std::uint8_t read_flag = 0x80,
+        std::uint8_t burst_flag = 0x00
+    ) noexcept
+      : m_spi{spi}, m_chip_select{chip_select}, m_read_flag{read_flag}, m_burst_flag{burst_flag}
+    {
+        m_chip_select.High();
+    }
+
+    /**
+     * @brief Read consecutive registers.
+     *
+     * @param address       First register address (0x00-0xFF).
+     * @param rx_message    Buffer to store the register contents.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Read(std::uint16_t address, std::span<std::uint8_t> rx_message) noexcept
+    {
+        const std::array<std::uint8_t, 1> header{Header(address, rx_message.size(), m_read_flag)};
+        m_chip_select.Low();
+        const bool success =
+            m_spi.template Transmit<WorkingMode::Blocking>(header) &&
+            m_spi.template ReceiveTo<WorkingMode::Blocking>(rx_message);
+        m_chip_select.High();
+        return success;
+    }
+
+    /**
+     * @brief Write consecutive registers.
+     *
+     * @param address       First register address (0x00-0xFF).
+     * @param tx_message    Register contents to write.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Write(std::uint16_t address, std::span<const std::uint8_t> tx_message) noexcept
+    {
+        const std::array<std::uint8_t, 1> header{Header(address, tx_message.size(), 0x00)};
+        m_chip_select.Low();
+        const bool success =
+            m_spi.template Transmit<WorkingMode::Blocking>(header) &&
+            m_spi.template Transmit<WorkingMode::Blocking>(tx_message);
+        m_chip_select.High();
+        return success;
+    }
+
+    /**
+     * @brief Read consecutive registers by DMA.
+     *
+     * The header and the data phase are a single full-duplex DMA transfer on
+     * rx_message, which is also its own transmit buffer: the header is placed
+     * in the first byte and the register contents follow it.
+     *
+     * @param address           First register address (0x00-0xFF).
+     * @param rx_message        DmaBuffer::Span() of read_offset plus the register bytes.
+     * @param complete_callback Callback function to be called upon completion or bus error.
+     *
+     * @returns True on success, false otherwise.
+     *
+     * @note The bytes clocked out after the header are the stale buffer
+     *       contents, devices ignore MOSI while returning register data.
+     */
+    bool ReadTo(
+        std::uint16_t address,
+        DmaSpan<std::uint8_t> rx_message,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        if (rx_message.size() <= read_offset) {
+            return false;
+        }
+        rx_message[0] = Header(address, rx_message.size() - read_offset, m_read_flag);
+        m_read_callback = std::move(complete_callback);
+        m_chip_select.Low();
+        /* The Spi routes bus errors to the completion callback as well */
+        const bool success = m_spi.template TransmitReceive<WorkingMode::DMA>(
+            rx_message, rx_message, [this](){
+                m_chip_select.High();
+                m_read_succeeded = !m_spi.HasError();
+                m_read_callback();
+            }
+        );
+        if (!success) {
+            m_chip_select.High();
+        }
+        return success;
+    }
+
+    /**
+     * @returns True if the last ReadTo() completed without a bus error, false otherwise.
+     */
+    [[nodiscard]]
+    bool LastReadSucceeded() const noexcept
+    {
+        return m_read_succeeded;
+    }
+
+private:
+    SpiT& m_spi;
+    GpioOutput& m_chip_select;
+    std::uint8_t m_read_flag;
+    std::uint8_t m_burst_flag;
+    CallbackT m_read_callback{};
+    bool m_read_succeeded{false};
+
+    /**
+     * @returns Header byte for a transfer.
+     */
+    std::uint8_t Header(std::uint16_t address, std::size_t size, std::uint8_t direction_flag) const noexcept
+    {
+        return static_cast<std::uint8_t>(
+            (address & 0xFF) | direction_flag | (size > 1 ? m_burst_flag : 0x00)
+        );
+    }
+};
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+/**
+ * @class RegisterMap, A shadow copy of device registers that minimizes bus traffic.
+ *
+ * Cached registers start at their reset values and are served from RAM once
+ * known, so read-modify-write sequences cost no read transaction. Staged
+ * values equal to the cached contents are dropped. Flush() writes all dirty
+ * registers, coalescing registers at consecutive addresses into one burst;
+ * up to two bytes of clean cached registers are rewritten to bridge a gap
+ * when that saves a transaction. Volatile registers are always read from the
+ * device, always written when staged and never used to bridge a gap.
+ *
+ * @tparam BusT         Register bus type (e.g., I2cRegisterBus, SpiRegisterBus).
+ * @tparam RegistersT   Registers of the map, in increasing address order.
+ *
+ * @note RegisterMap class is non-copyable and non-movable.
+ * @note Coalescing assumes the device auto-increments the register address by
+ *       one per byte.
+ * @note Call Invalidate() if the device may have been reset independently
+ *       (e.g., after an MCU reset without a power cycle).
+ * @note Not interrupt safe, use from a single context.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized by CubeMX
+ *
+ * using CtrlReg1 = STM32::Register<0x20, 1, STM32::RegisterAccess::Cached, 0x07>;
+ * using CtrlReg2 = STM32::Register<0x21, 1>;
+ * using CtrlReg3 = STM32::Register<0x22, 1>;
+ * using CtrlReg4 = STM32::Register<0x23, 1>;
+ * using Status = STM32::Register<0x27, 1, STM32::RegisterAccess::Volatile>;
+ *
+ * STM32::I2c<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cRegisterBus bus{i2c, 0x18};
+ * STM32::RegisterMap<decltype(bus), CtrlReg1, CtrlReg2, CtrlReg3, CtrlReg4, Status> registers{bus};
+ *
+ * // 1. Stage several changes, then write them as one burst (0x20-0x23)
+ * registers.Stage<CtrlReg1>(0x57);
+ * registers.StageModify<CtrlReg4>(0x30, 0x10);   // clear FS bits, set +-4g, no bus read
+ * registers.Stage<CtrlReg3>(0x00);               // equal to cache, dropped
+ * registers.Flush();
+ *
+ * // 2. Immediate write, skipped if unchanged
+ * registers.Write<CtrlReg2>(0x00);
+ *
+ * // 3. Volatile registers always hit the bus
+ * std::uint8_t status{};
+ * registers.ReadTo<Status>(status);
+ * @endcode
+ */
+template <IsRegisterBus BusT, IsRegister... RegistersT>
+class RegisterMap {
+    static constexpr std::size_t register_count{sizeof...(RegistersT)};
+    static constexpr std::size_t max_bridge_bytes{2};
+    static constexpr std::array<std::uint16_t, register_count> addresses{RegistersT::address...};
+    static constexpr std::array<std::size_t, register_count> widths{RegistersT::width...};
+    static constexpr std::array<bool, register_count> volatiles{
+        (RegistersT::access == RegisterAccess::Volatile)...
+    };
+    static constexpr auto offsets = [](){
+        std::array<std::size_t, register_count> result{};
+        std::size_t offset{0};
+        for (std::size_t i = 0; i < register_count; ++i) {
+            result[i] = offset;
+            offset += widths[i];
+        }
+        return result;
+    }();
+    static constexpr std::size_t cache_size{(RegistersT::width + ...)};
+
+    static_assert(register_count > 0, "Register map must contain at least one register");
+    static_assert(
+        [](){
+            for (std::size_t i = 1; i < register_count; ++i) {
+                if (addresses[i] < addresses[i - 1] + widths[i - 1]) {
+                    return false;
+                }
+            }
+            return true;
+        }(),
+        "Registers must be listed in increasing, non-overlapping address order"
+    );
+
+    template <typename RegisterT>
+    static constexpr std::size_t index_of = [](){
+        constexpr std::array<bool, register_count> matches{std::same_as<RegisterT, RegistersT>...};
+        std::size_t index{0};
+        while (index < register_count && !matches[index]) {
+            ++index;
+        }
+        return index;
+    }();
+
+    template <typename RegisterT>
+    static constexpr bool contains = (std::same_as<RegisterT, RegistersT> || ...);
+public:
+
+    /**
+     * @brief Construct RegisterMap class.
+     *
+     * @param bus       Reference to the register bus.
+     *
+     * @note Cached registers are assumed to hold their reset values.
+     */
+    explicit RegisterMap(BusT& bus) noexcept
+      : m_bus{bus}
+    {
+        (StoreValue<RegistersT>(RegistersT::reset_value), ...);
+        m_valid = {(RegistersT::access == RegisterAccess::Cached)...};
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    RegisterMap(const RegisterMap&) = delete;
+    RegisterMap& operator=(const RegisterMap&) = delete;
+    RegisterMap(RegisterMap&&) = delete;
+    RegisterMap& operator=(RegisterMap&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy RegisterMap class.
+     */
+    ~RegisterMap() = default;
+
+    /**
+     * @brief Read a register, from the cache when possible.
+     *
+     * @tparam RegisterT    Register to read.
+     *
+     * @param value         Reference to store the value (staged value if not yet flushed).
+     *
+     * @returns True on success, false on bus error.
+     */
+    template <IsRegister RegisterT>
+    requires contains<RegisterT>
+    bool ReadTo(typename RegisterT::ValueT& value) noexcept
+    {
+        constexpr auto index = index_of<RegisterT>;
+        if constexpr (RegisterT::access == RegisterAccess::Volatile) {
+            std::array<std::uint8_t, RegisterT::width> bytes{};
+            if (!m_bus.Read(RegisterT::address, bytes)) {
+                return false;
+            }
+            value = Decode<RegisterT>(bytes);
+        } else {
+            if (!m_valid[index]) {
+                if (!m_bus.Read(RegisterT::address, Bytes<RegisterT>())) {
+                    return false;
+                }
+                m_valid[index] = true;
+            }
+            value = Decode<RegisterT>(Bytes<RegisterT>());
+        }
+        return true;
+    }
+
+    /**
+     * @brief Stage a register value for the next Flush().
+     *
+     * @tparam RegisterT    Register to write.
+     *
+     * @param value         Value to write.
+     */
+    template <IsRegister RegisterT>
+    requires contains<RegisterT>
+    void Stage(typename RegisterT::ValueT value) noexcept
+    {
+        constexpr auto index = index_of<RegisterT>;
+        if constexpr (RegisterT::access == RegisterAccess::Cached) {
+            if (m_valid[index] && Decode<RegisterT>(Bytes<RegisterT>()) == value) {
+                return;
+            }
+            m_valid[index] = true;
+        }
+        StoreValue<RegisterT>(value);
+        m_dirty[index] = true;
+    }
+
+    /**
+     * @brief Stage a read-modify-write of a register for the next Flush().
+     *
+     * @tparam RegisterT    Register to modify.
+     *
+     * @param clear_mask    Bits to clear.
+     * @param set_mask      Bits to set (applied after clearing).
+     *
+     * @returns True on success, false if reading the current value failed.
+     */
+    template <IsRegister RegisterT>
+    requires contains<RegisterT>
+    bool StageModify(typename RegisterT::ValueT clear_mask, typename RegisterT::ValueT set_mask) noexcept
+    {
+        typename RegisterT::ValueT value{};
+        if (!ReadTo<RegisterT>(value)) {
+            return false;
+        }
+        Stage<RegisterT>(static_cast<typename RegisterT::ValueT>((value & ~clear_mask) | set_mask));
+        return true;
+    }
+
+    /**
+     * @brief Write a register value and flush.
+     *
+     * @tparam RegisterT    Register to write.
+     *
+     * @param value         Value to write.
+     *
+     * @returns True on success, false on bus error.
+     */
+    template <IsRegister RegisterT>
+    requires contains<RegisterT>
+    bool Write(typename RegisterT::ValueT value) noexcept
+    {
+        Stage<RegisterT>(value);
+        return Flush();
+    }
+
+    /**
+     * @brief Read-modify-write a register and flush.
+     *
+     * @tparam RegisterT    Register to modify.
+     *
+     * @param clear_mask    Bits to clear.
+     * @param set_mask      Bits to set (applied after clearing).
+     *
+     * @returns True on success, false on bus error.
+     */
+    template <IsRegister RegisterT>
+    requires contains<RegisterT>
+    bool Modify(typename RegisterT::ValueT clear_mask, typename RegisterT::ValueT set_mask) noexcept
+    {
+        return StageModify<RegisterT>(clear_mask, set_mask) && Flush();
+    }
+
+    /**
+     * @brief Write all staged registers, coalescing consecutive ones into bursts.
+     *
+     * @returns True on success, false on bus error (failed registers stay dirty).
+     */
+    bool Flush() noexcept
+    {
+        bool success = true;
+        std::size_t first = 0;
+        while (first < register_count) {
+            if (!m_dirty[first]) {
+                ++first;
+                continue;
+            }
+            std::size_t last = first;
+            for (std::size_t next = first + 1; next < register_count && IsAdjacent(next); ++next) {
+                if (m_dirty[next]) {
+                    last = next;
+                } else if (volatiles[next] || !m_valid[next] || BridgeBytes(last, next) > max_bridge_bytes) {
+                    break;
+                }
+            }
+            const std::span<const std::uint8_t> burst{
+                m_cache.data() + offsets[first],
+                offsets[last] + widths[last] - offsets[first]
+            };
+            if (m_bus.Write(addresses[first], burst)) {
+                for (std::size_t i = first; i <= last; ++i) {
+                    m_dirty[i] = false;
+                }
+            } else {
+                success = false;
+            }
+            first = last + 1;
+        }
+        return success;
+    }
+
+    /**
+     * @returns True if any register is staged but not yet written.
+     */
+    [[nodiscard]]
+    bool IsDirty() const noexcept
+    {
+        for (const auto dirty : m_dirty) {
+            if (dirty) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Forget cached contents and staged values, the next reads hit the bus.
+     */
+    void Invalidate() noexcept
+    {
+        m_valid.fill(false);
+        m_dirty.fill(false);
+    }
+
+private:
+    BusT& m_bus;
+    std::array<std::uint8_t, cache_size> m_cache{};
+    std::array<bool, register_count> m_valid{};
+    std::array<bool, register_count> m_dirty{};
+
+    /**
+     * @returns True if the register follows the previous one without an address gap.
+     */
+    static constexpr bool IsAdjacent(std::size_t index) noexcept
+    {
+        return addresses[index] == addresses[index - 1] + widths[index - 1];
+    }
+
+    /**
+     * @returns Number of clean bytes rewritten to extend a burst ending at last up to index.
+     */
+    static constexpr std::size_t BridgeBytes(std::size_t last, std::size_t index) noexcept
+    {
+        return offsets[index] + widths[index] - (offsets[last] + widths[last]);
+    }
+
+    /**
+     * @returns Cache bytes of a register in bus order.
+     */
+    template <typename RegisterT>
+    std::span<std::uint8_t, RegisterT::width> Bytes() noexcept
+    {
+        return std::span<std::uint8_t, RegisterT::width>{
+            m_cache.data() + offsets[index_of<RegisterT>], RegisterT::width
+        };
+    }
+
+    /**
+     * @brief Store a value into the cache in bus order.
+     */
+    template <typename RegisterT>
+    void StoreValue(typename RegisterT::ValueT value) noexcept
+    {
+        auto bytes = Bytes<RegisterT>();
+        for (std::size_t i = 0; i < RegisterT::width; ++i) {
+            const auto shift = (RegisterT::byte_order == std::endian::big) ?
+                8 * (RegisterT::width - 1 - i) : 8 * i;
+            bytes[i] = static_cast<std::uint8_t>(value >> shift);
+        }
+    }
+
+    /**
+     * @returns Value of bus ordered bytes.
+     */
+    template <typename RegisterT>
+    static constexpr typename RegisterT::ValueT Decode(std::span<const std::uint8_t, RegisterT::width> bytes) noexcept
+    {
+        std::uint32_t value{0};
+        for (std::size_t i = 0; i < RegisterT::width; ++i) {
+            const auto shift = (RegisterT::byte_order == std::endian::big) ?
+                8 * (RegisterT::width - 1 - i) : 8 * i;
+            value |= static_cast<std::uint32_t>(bytes[i]) << shift;
+        }
+        return static_cast<typename RegisterT::ValueT>(value);
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_REGISTER_MAP_HPP */
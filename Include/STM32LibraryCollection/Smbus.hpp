@@ -0,0 +1,914 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_SMBUS_HPP
+#define STM32_SMBUS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "__Internal/__Utility.hpp"
+#include "Crc8.hpp"
+
+#include "main.h"
+
+#if defined(HAL_I2C_MODULE_ENABLED) && (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+#include "I2c.hpp"
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+namespace STM32 {
+
+namespace __Internal {
+
+/**
+ * @class __SmbusTransfer, State and frame buffer of a single SMBus transaction.
+ *
+ * The buffer holds the command code at index 0, followed by the byte count
+ * (block transfers), the data bytes and the PEC, in wire order.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+class __SmbusTransfer {
+public:
+    static constexpr std::size_t max_block_size{32};
+
+    /**
+     * @brief Claim the transfer for a new transaction.
+     *
+     * @returns True if no transaction was in progress, false otherwise.
+     */
+    bool Begin(std::uint16_t device_address, std::uint8_t command, CallbackT&& complete_callback) noexcept
+    {
+        if (m_busy.load(std::memory_order_acquire)) {
+            return false;
+        }
+        m_busy.store(true, std::memory_order_release);
+        m_success.store(false, std::memory_order_relaxed);
+        m_device_address = device_address;
+        m_buffer[0] = command;
+        m_data_offset = 1;
+        m_data_size = 0;
+        m_complete_callback = std::move(complete_callback);
+        return true;
+    }
+
+    /**
+     * @brief Release the transfer after a transaction failed to start.
+     *
+     * @returns Always false, for use in return statements.
+     */
+    bool Abort() noexcept
+    {
+        m_complete_callback.Reset();
+        m_busy.store(false, std::memory_order_release);
+        return false;
+    }
+
+    /**
+     * @brief Finish the transaction and invoke the completion callback.
+     *
+     * @param success   Whether the transaction succeeded.
+     */
+    void Complete(bool success) noexcept
+    {
+        if (!m_busy.load(std::memory_order_acquire)) {
+            return;
+        }
+        auto complete_callback = std::move(m_complete_callback);
+        m_success.store(success, std::memory_order_relaxed);
+        m_busy.store(false, std::memory_order_release);
+        complete_callback();
+    }
+
+    /**
+     * @brief Copy the payload of a write after the command code.
+     *
+     * @param data      Data bytes to write.
+     * @param block     Whether a byte count precedes the data.
+     *
+     * @returns Number of bytes in the frame, without the PEC.
+     */
+    std::size_t StageWrite(std::span<const std::uint8_t> data, bool block) noexcept
+    {
+        std::size_t size = 1;
+        if (block) {
+            m_buffer[size++] = static_cast<std::uint8_t>(data.size());
+        }
+        std::ranges::copy(data, m_buffer.begin() + size);
+        return size + data.size();
+    }
+
+    /**
+     * @brief Select the received data bytes returned by Data().
+     */
+    void SetData(std::size_t offset, std::size_t size) noexcept
+    {
+        m_data_offset = offset;
+        m_data_size = size;
+    }
+
+    /**
+     * @returns SMBus PEC of the command code followed by frame bytes [1, size).
+     *
+     * @param read      Whether a repeated START with the read address precedes the bytes.
+     */
+    [[nodiscard]]
+    std::uint8_t Pec(std::size_t size, bool read) const noexcept
+    {
+        auto crc = Crc8Smbus::Init();
+        crc = Crc8Smbus::Update(crc, static_cast<std::uint8_t>(m_device_address << 1));
+        crc = Crc8Smbus::Update(crc, m_buffer[0]);
+        if (read) {
+            crc = Crc8Smbus::Update(crc, static_cast<std::uint8_t>((m_device_address << 1) | 0x01));
+        }
+        crc = Crc8Smbus::Update(crc, std::span<const std::uint8_t>{m_buffer.data() + 1, size - 1});
+        return Crc8Smbus::Finalize(crc);
+    }
+
+    /**
+     * @returns 7-bit device address of the transaction.
+     */
+    [[nodiscard]]
+    std::uint16_t DeviceAddress() const noexcept
+    {
+        return m_device_address;
+    }
+
+    /**
+     * @returns Pointer to the frame buffer, starting with the command code.
+     */
+    [[nodiscard]]
+    std::uint8_t* Frame() noexcept
+    {
+        return m_buffer.data();
+    }
+
+    /**
+     * @returns Data bytes selected by SetData().
+     */
+    [[nodiscard]]
+    std::span<const std::uint8_t> Data() const noexcept
+    {
+        return std::span<const std::uint8_t>{m_buffer.data() + m_data_offset, m_data_size};
+    }
+
+    /**
+     * @returns True if a transaction is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_busy.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns True if the last transaction succeeded.
+     */
+    [[nodiscard]]
+    bool Succeeded() const noexcept
+    {
+        return m_success.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<std::uint8_t, max_block_size + 3> m_buffer{};
+    std::uint16_t m_device_address{0};
+    std::size_t m_data_offset{1};
+    std::size_t m_data_size{0};
+    CallbackT m_complete_callback{};
+    std::atomic<bool> m_busy{false};
+    std::atomic<bool> m_success{false};
+};
+
+} /* namespace __Internal */
+
+#if defined(HAL_I2C_MODULE_ENABLED) && (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+/**
+ * @class I2cSmbus, SMBus transactions with software Packet Error Checking over an I2c.
+ *
+ * For I2C peripherals configured as plain I2C (or parts without SMBus PEC
+ * hardware). The PEC is computed with the table-driven Crc8Smbus, appended to
+ * writes and verified on reads, so each byte costs one table lookup.
+ *
+ * Every operation is non-blocking; when the completion callback runs,
+ * LastTransferSucceeded() tells whether the device acknowledged and the PEC
+ * matched, and GetData() holds the bytes read.
+ *
+ * @tparam I2cT     I2c type (any working mode, transfers always use interrupt mode).
+ *
+ * @note I2cSmbus class is non-copyable and non-movable.
+ * @note Each transfer passes its own error callback, the I2c error callback
+ *       is left to the application.
+ * @note Only one transaction can be in progress, operations return false while busy.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Smbus.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume properly initialized by CubeMX
+ *
+ * STM32::I2c<STM32::WorkingMode::Interrupt, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cSmbus smbus{i2c};
+ *
+ * // Smart battery: RelativeStateOfCharge (0x0D)
+ * smbus.ReadWord(0x0B, 0x0D, [&smbus](){
+ *     if (smbus.LastTransferSucceeded()) {
+ *         auto percent = smbus.GetWord();
+ *     }
+ * });
+ *
+ * // Smart battery: ManufacturerName (0x20), a block read
+ * smbus.BlockRead(0x0B, 0x20, [&smbus](){
+ *     if (smbus.LastTransferSucceeded()) {
+ *         auto name = smbus.GetData();
+ *     }
+ * });
+ * @endcode
+ */
+template <IsI2c I2cT>
+class I2cSmbus {
+public:
+    static constexpr std::size_t max_block_size{__Internal::__SmbusTransfer::max_block_size};
+
+    /**
+     * @brief Construct I2cSmbus class.
+     *
+     * @param i2c   Reference to the I2c connected to the bus.
+     */
+    explicit I2cSmbus(I2cT& i2c) noexcept
+      : m_i2c{i2c}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cSmbus(const I2cSmbus&) = delete;
+    I2cSmbus& operator=(const I2cSmbus&) = delete;
+    I2cSmbus(I2cSmbus&&) = delete;
+    I2cSmbus& operator=(I2cSmbus&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cSmbus class.
+     */
+    ~I2cSmbus() = default;
+
+    /**
+     * @brief SMBus Write Byte with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param value             Data byte.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool WriteByte(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::uint8_t value,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        const std::array<std::uint8_t, 1> data{value};
+        return Write(device_address, command, data, false, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Write Word with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param value             Data word, sent low byte first.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool WriteWord(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::uint16_t value,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        const std::array<std::uint8_t, 2> data{
+            static_cast<std::uint8_t>(value & 0xFF),
+            static_cast<std::uint8_t>(value >> 8)
+        };
+        return Write(device_address, command, data, false, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Block Write with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param data              Data bytes (at most 32).
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise (including too much data).
+     */
+    bool BlockWrite(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::span<const std::uint8_t> data,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (data.size() > max_block_size) {
+            return false;
+        }
+        return Write(device_address, command, data, true, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Read Byte with PEC, the byte is returned by GetData().
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool ReadByte(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        return Read(device_address, command, 1, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Read Word with PEC, the word is returned by GetWord().
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool ReadWord(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        return Read(device_address, command, 2, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Block Read with PEC, the block is returned by GetData().
+     *
+     * The byte count is received first and the rest of the block is read in
+     * the same transaction, so exactly count + 1 bytes are clocked.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool BlockRead(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (!m_transfer.Begin(device_address, command, std::move(complete_callback))) {
+            return false;
+        }
+        const bool started = m_i2c.template SequentialTransmit<WorkingMode::Interrupt>(
+            device_address, std::span<const std::uint8_t>{m_transfer.Frame(), 1}, I2cFrame::First,
+            [this](){
+                ReceiveBlockCount();
+            },
+            [this](){
+                m_transfer.Complete(false);
+            }
+        );
+        return started || m_transfer.Abort();
+    }
+
+    /**
+     * @returns Bytes read by the last read operation.
+     */
+    [[nodiscard]]
+    std::span<const std::uint8_t> GetData() const noexcept
+    {
+        return m_transfer.Data();
+    }
+
+    /**
+     * @returns Word read by the last ReadWord().
+     */
+    [[nodiscard]]
+    std::uint16_t GetWord() const noexcept
+    {
+        const auto data = m_transfer.Data();
+        return static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+    }
+
+    /**
+     * @returns True if a transaction is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_transfer.IsBusy();
+    }
+
+    /**
+     * @returns True if the last transaction was acknowledged and its PEC matched.
+     */
+    [[nodiscard]]
+    bool LastTransferSucceeded() const noexcept
+    {
+        return m_transfer.Succeeded();
+    }
+
+private:
+    I2cT& m_i2c;
+    __Internal::__SmbusTransfer m_transfer{};
+
+    /**
+     * @brief Send command, payload and PEC as one I2C memory write.
+     */
+    bool Write(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::span<const std::uint8_t> data,
+        bool block,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        if (!m_transfer.Begin(device_address, command, std::move(complete_callback))) {
+            return false;
+        }
+        const auto size = m_transfer.StageWrite(data, block);
+        m_transfer.Frame()[size] = m_transfer.Pec(size, false);
+        const bool started = m_i2c.template MemoryWrite<WorkingMode::Interrupt>(
+            device_address, command, I2cMemoryAddressSize::Bits8,
+            std::span<const std::uint8_t>{m_transfer.Frame() + 1, size},
+            [this](){
+                m_transfer.Complete(true);
+            },
+            [this](){
+                m_transfer.Complete(false);
+            }
+        );
+        return started || m_transfer.Abort();
+    }
+
+    /**
+     * @brief Read a fixed number of data bytes and the PEC as one I2C memory read.
+     */
+    bool Read(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::size_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        if (!m_transfer.Begin(device_address, command, std::move(complete_callback))) {
+            return false;
+        }
+        std::span<std::uint8_t> rx_message{m_transfer.Frame() + 1, size + 1};
+        const bool started = m_i2c.template MemoryReadTo<WorkingMode::Interrupt>(
+            device_address, command, I2cMemoryAddressSize::Bits8, rx_message,
+            [this, size](){
+                m_transfer.SetData(1, size);
+                m_transfer.Complete(m_transfer.Pec(size + 1, true) == m_transfer.Frame()[size + 1]);
+            },
+            [this](){
+                m_transfer.Complete(false);
+            }
+        );
+        return started || m_transfer.Abort();
+    }
+
+    /**
+     * @brief Receive the byte count of a block read after the repeated START.
+     */
+    void ReceiveBlockCount() noexcept
+    {
+        std::span<std::uint8_t> rx_message{m_transfer.Frame() + 1, 1};
+        const bool started = m_i2c.template SequentialReceiveTo<WorkingMode::Interrupt>(
+            m_transfer.DeviceAddress(), rx_message, I2cFrame::Next,
+            [this](){
+                ReceiveBlockData();
+            },
+            [this](){
+                m_transfer.Complete(false);
+            }
+        );
+        if (!started) {
+            m_transfer.Complete(false);
+        }
+    }
+
+    /**
+     * @brief Receive the data bytes and the PEC of a block read.
+     */
+    void ReceiveBlockData() noexcept
+    {
+        const std::size_t count = m_transfer.Frame()[1];
+        const auto size = std::min(count, max_block_size);
+        std::span<std::uint8_t> rx_message{m_transfer.Frame() + 2, size + 1};
+        const bool started = m_i2c.template SequentialReceiveTo<WorkingMode::Interrupt>(
+            m_transfer.DeviceAddress(), rx_message, I2cFrame::Last,
+            [this, count, size](){
+                m_transfer.SetData(2, size);
+                m_transfer.Complete(
+                    count <= max_block_size &&
+                    m_transfer.Pec(size + 2, true) == m_transfer.Frame()[size + 2]
+                );
+            },
+            [this](){
+                m_transfer.Complete(false);
+            }
+        );
+        if (!started) {
+            m_transfer.Complete(false);
+        }
+    }
+};
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+#if defined(HAL_SMBUS_MODULE_ENABLED) && (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
+/**
+ * @class Smbus, SMBus transactions with hardware Packet Error Checking.
+ *
+ * For I2C peripherals configured as SMBus by CubeMX with Packet Error
+ * Checking enabled. The peripheral appends the PEC to writes and checks it on
+ * reads, a mismatch ends the transaction with HAL_SMBUS_ERROR_PECERR. The
+ * interface is the same as I2cSmbus, so drivers can use either.
+ *
+ * @tparam UniqueTagT   Unique tag type (use STM32_UNIQUE_TAG).
+ *
+ * @note Smbus class is non-copyable and non-movable.
+ * @note Only one transaction can be in progress, operations return false while busy.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Smbus.hpp>
+ *
+ * SMBUS_HandleTypeDef hsmbus1; // Assume initialized by CubeMX with PEC enabled
+ *
+ * STM32::Smbus<STM32_UNIQUE_TAG> smbus{hsmbus1};
+ *
+ * // Smart battery: Voltage (0x09)
+ * smbus.ReadWord(0x0B, 0x09, [&smbus](){
+ *     if (smbus.LastTransferSucceeded()) {
+ *         auto millivolts = smbus.GetWord();
+ *     }
+ * });
+ * @endcode
+ */
+template <__Internal::__IsUniqueTag UniqueTagT>
+class Smbus {
+    using MasterTransmitCompleteCallbackT = __Internal::__CallbackManager<
+        SMBUS_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_SMBUS_RegisterCallback, HAL_SMBUS_UnRegisterCallback, HAL_SMBUS_MASTER_TX_COMPLETE_CB_ID
+    >;
+    using MasterReceiveCompleteCallbackT = __Internal::__CallbackManager<
+        SMBUS_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_SMBUS_RegisterCallback, HAL_SMBUS_UnRegisterCallback, HAL_SMBUS_MASTER_RX_COMPLETE_CB_ID
+    >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        SMBUS_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_SMBUS_RegisterCallback, HAL_SMBUS_UnRegisterCallback, HAL_SMBUS_ERROR_CB_ID
+    >;
+public:
+    static constexpr std::size_t max_block_size{__Internal::__SmbusTransfer::max_block_size};
+
+    /**
+     * @brief Construct Smbus class.
+     *
+     * @param handle    Reference to the SMBUS handle.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    explicit Smbus(SMBUS_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_master_transmit_complete_callback{handle},
+        m_master_receive_complete_callback{handle},
+        m_error_callback{handle}
+    {
+        m_error_callback.Set([this](){
+            m_transfer.Complete(false);
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Smbus(const Smbus&) = delete;
+    Smbus& operator=(const Smbus&) = delete;
+    Smbus(Smbus&&) = delete;
+    Smbus& operator=(Smbus&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Smbus class.
+     *
+     * @note HAL callbacks are automatically unregistered via RAII.
+     */
+    ~Smbus() = default;
+
+    /**
+     * @returns HAL SMBUS handle.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief SMBus Write Byte with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param value             Data byte.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool WriteByte(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::uint8_t value,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        const std::array<std::uint8_t, 1> data{value};
+        return Write(device_address, command, data, false, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Write Word with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param value             Data word, sent low byte first.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool WriteWord(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::uint16_t value,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        const std::array<std::uint8_t, 2> data{
+            static_cast<std::uint8_t>(value & 0xFF),
+            static_cast<std::uint8_t>(value >> 8)
+        };
+        return Write(device_address, command, data, false, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Block Write with PEC.
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param data              Data bytes (at most 32).
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise (including too much data).
+     */
+    bool BlockWrite(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::span<const std::uint8_t> data,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        if (data.size() > max_block_size) {
+            return false;
+        }
+        return Write(device_address, command, data, true, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Read Byte with PEC, the byte is returned by GetData().
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool ReadByte(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        return Read(device_address, command, 1, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Read Word with PEC, the word is returned by GetWord().
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool ReadWord(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        return Read(device_address, command, 2, std::move(complete_callback));
+    }
+
+    /**
+     * @brief SMBus Block Read with PEC, the block is returned by GetData().
+     *
+     * @param device_address    7-bit device address.
+     * @param command           Command code.
+     * @param complete_callback Callback function to be called upon completion.
+     *
+     * @returns True if the transaction started, false otherwise.
+     */
+    bool BlockRead(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    {
+        return Read(device_address, command, 0, std::move(complete_callback));
+    }
+
+    /**
+     * @returns Bytes read by the last read operation.
+     */
+    [[nodiscard]]
+    std::span<const std::uint8_t> GetData() const noexcept
+    {
+        return m_transfer.Data();
+    }
+
+    /**
+     * @returns Word read by the last ReadWord().
+     */
+    [[nodiscard]]
+    std::uint16_t GetWord() const noexcept
+    {
+        const auto data = m_transfer.Data();
+        return static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+    }
+
+    /**
+     * @returns True if a transaction is in progress.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_transfer.IsBusy();
+    }
+
+    /**
+     * @returns True if the last transaction was acknowledged and its PEC matched.
+     */
+    [[nodiscard]]
+    bool LastTransferSucceeded() const noexcept
+    {
+        return m_transfer.Succeeded();
+    }
+
+private:
+    SMBUS_HandleTypeDef& m_handle;
+    MasterTransmitCompleteCallbackT m_master_transmit_complete_callback;
+    MasterReceiveCompleteCallbackT m_master_receive_complete_callback;
+    ErrorCallbackT m_error_callback;
+    __Internal::__SmbusTransfer m_transfer{};
+
+    /**
+     * @brief Send command and payload, the peripheral appends the PEC.
+     */
+    bool Write(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::span<const std::uint8_t> data,
+        bool block,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        if (!m_transfer.Begin(device_address, command, std::move(complete_callback))) {
+            return false;
+        }
+        const auto size = m_transfer.StageWrite(data, block);
+        m_master_transmit_complete_callback.Set([this](){
+            m_transfer.Complete(true);
+        });
+        /* The transfer size includes the PEC byte sent by the peripheral */
+        const bool started = (HAL_OK == HAL_SMBUS_Master_Transmit_IT(
+            &m_handle,
+            static_cast<std::uint16_t>(device_address << 1),
+            m_transfer.Frame(),
+            static_cast<std::uint16_t>(size + 1),
+            SMBUS_FIRST_AND_LAST_FRAME_WITH_PEC
+        ));
+        return started || m_transfer.Abort();
+    }
+
+    /**
+     * @brief Send the command code, then read the response after a repeated START.
+     *
+     * @param size  Number of data bytes, 0 for a block read.
+     */
+    bool Read(
+        std::uint16_t device_address,
+        std::uint8_t command,
+        std::size_t size,
+        CallbackT&& complete_callback
+    ) noexcept
+    {
+        if (!m_transfer.Begin(device_address, command, std::move(complete_callback))) {
+            return false;
+        }
+        m_master_transmit_complete_callback.Set([this, size](){
+            const bool started = (size == 0) ? ReceiveBlockCount() : Receive(1, size);
+            if (!started) {
+                m_transfer.Complete(false);
+            }
+        });
+        const bool started = (HAL_OK == HAL_SMBUS_Master_Transmit_IT(
+            &m_handle,
+            static_cast<std::uint16_t>(device_address << 1),
+            m_transfer.Frame(),
+            1,
+            SMBUS_FIRST_FRAME
+        ));
+        return started || m_transfer.Abort();
+    }
+
+    /**
+     * @brief Receive the byte count of a block read.
+     */
+    bool ReceiveBlockCount() noexcept
+    {
+        m_master_receive_complete_callback.Set([this](){
+            ReceiveBlockData();
+        });
+        return (HAL_OK == HAL_SMBUS_Master_Receive_IT(
+            &m_handle,
+            static_cast<std::uint16_t>(m_transfer.DeviceAddress() << 1),
+            m_transfer.Frame() + 1,
+            1,
+            SMBUS_NEXT_FRAME
+        ));
+    }
+
+    /**
+     * @brief Receive the data bytes of a block read once the byte count is known.
+     */
+    void ReceiveBlockData() noexcept
+    {
+        const std::size_t count = m_transfer.Frame()[1];
+        if (count > max_block_size || !Receive(2, count)) {
+            m_transfer.Complete(false);
+        }
+    }
+
+    /**
+     * @brief Receive data bytes, the peripheral checks the PEC and generates STOP.
+     *
+     * @param offset    Frame index of the first data byte.
+     * @param size      Number of data bytes.
+     */
+    bool Receive(std::size_t offset, std::size_t size) noexcept
+    {
+        m_master_receive_complete_callback.Set([this, offset, size](){
+            m_transfer.SetData(offset, size);
+            m_transfer.Complete(true);
+        });
+        /* The transfer size includes the PEC byte checked by the peripheral */
+        return (HAL_OK == HAL_SMBUS_Master_Receive_IT(
+            &m_handle,
+            static_cast<std::uint16_t>(m_transfer.DeviceAddress() << 1),
+            m_transfer.Frame() + offset,
+            static_cast<std::uint16_t>(size + 1),
+            SMBUS_LAST_FRAME_WITH_PEC
+        ));
+    }
+};
+#endif /* HAL_SMBUS_MODULE_ENABLED */
+
+} /* namespace STM32 */
+
+#endif /* STM32_SMBUS_HPP */
@@ -9,8 +9,10 @@
 #include <cstdint>
 #include <limits>
 #include <ranges>
+#include <utility>
 
 #include "Config.hpp"
+#include "DmaBuffer.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -95,6 +97,96 @@ concept IsSpiTimeout =
 template <typename T>
 concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
 
+/**
+ * @struct SpiFillByte, A utility struct to hold the byte clocked out during receive-only transfers.
+ * 
+ * @tparam FillByteV    Byte value transmitted on MOSI while receiving (e.g., 0xFF or 0x00).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * using MyFillByte = STM32::SpiFillByte<0xFF>;
+ * auto fill = MyFillByte::value; // fill is 0xFF.
+ * @endcode
+ */
+template <std::uint8_t FillByteV>
+struct SpiFillByte : __Internal::__Constant<std::uint8_t, FillByteV> {};
+
+/**
+ * @brief IsSpiFillByte, A concept to check if a type is a SpiFillByte.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * static_assert(STM32::IsSpiFillByte<STM32::SpiFillByte<0xFF>>);
+ * static_assert(!STM32::IsSpiFillByte<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiFillByte =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint8_t>;
+
+/**
+ * @struct SpiCrcPolynomial, A utility struct to hold the hardware CRC polynomial.
+ * 
+ * The polynomial is written to the SPI CRC polynomial register, without the
+ * implicit highest-order bit (e.g., 0x1021 for CRC-16-CCITT, 0x07 for CRC-8).
+ * 
+ * @tparam PolynomialV  CRC polynomial value, must be odd.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * using SdCardCrc = STM32::SpiCrcPolynomial<0x1021>;
+ * auto polynomial = SdCardCrc::value; // polynomial is 0x1021.
+ * @endcode
+ */
+template <std::uint32_t PolynomialV>
+struct SpiCrcPolynomial : __Internal::__Constant<std::uint32_t, PolynomialV> {
+    static_assert(
+        PolynomialV % 2 == 1,
+        "CRC polynomial must be odd"
+    );
+};
+
+/**
+ * @brief IsSpiCrcPolynomial, A concept to check if a type is a SpiCrcPolynomial.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * static_assert(STM32::IsSpiCrcPolynomial<STM32::SpiCrcPolynomial<0x07>>);
+ * static_assert(!STM32::IsSpiCrcPolynomial<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiCrcPolynomial =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t> &&
+    T::value % 2 == 1;
+
+#if defined(SPI_CRC_LENGTH_DATASIZE)
+/**
+ * @enum SpiCrcLength, Length of the hardware CRC.
+ * 
+ * @note Only available on devices with configurable CRC length (e.g., STM32F0/F3/F7/L4/G4/H7).
+ */
+enum class SpiCrcLength : std::uint32_t {
+    DataSize = SPI_CRC_LENGTH_DATASIZE, /**< Same as the SPI data size */
+    Bits8 = SPI_CRC_LENGTH_8BIT,        /**< 8-bit CRC */
+    Bits16 = SPI_CRC_LENGTH_16BIT       /**< 16-bit CRC */
+};
+#endif /* SPI_CRC_LENGTH_DATASIZE */
+
 /**
  * @class Spi, A class to manage SPI functionality on STM32 microcontrollers.
  * 
@@ -103,6 +195,10 @@ concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
  * - Transmit only (Transmit)
  * - Receive only (ReceiveTo)
  * - Simultaneous transmit and receive (TransmitReceive)
+ * - Receive with a constant fill byte on MOSI (ReceiveWithFillTo)
+ * - Transmit while discarding the received data (TransmitWithDiscard)
+ * - Hardware CRC calculation and check (EnableCrc, DisableCrc, HasCrcError)
+ * - Error reporting of the last transfer (HasError, GetError)
  * 
  * @tparam WorkingModeT         Working mode of the SPI
  *                              (WorkingMode::Blocking, WorkingMode::Interrupt, WorkingMode::DMA).
@@ -111,6 +207,11 @@ concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
  *
  * @note Spi class is non-copyable and non-movable.
  * @note CS/NSS pin management is the user's responsibility (manual GPIO or hardware NSS).
+ * @note On cores with data cache, DMA receive buffers must be DmaBuffer, cache
+ *       maintenance is performed automatically on the transferred range.
+ * @note Non-blocking operations invoke their completion callback on error as
+ *       well (e.g., DMA, overrun, mode fault or CRC error), use HasError() in
+ *       the callback to tell a failed transfer from a completed one.
  *
  * @example Usage:
  * @code {.cpp}
@@ -144,6 +245,25 @@ concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
  *
  * // 5. Blocking mode with custom timeout
  * spi.TransmitReceive<STM32::WorkingMode::Blocking, STM32::SpiTimeout<500>>(tx_data, rx_data);
+ *
+ * // 6. Read a 4 KB flash page without a dummy TX buffer, clocking out 0xFF
+ * std::array<std::uint8_t, 4096> page{};
+ * spi.ReceiveWithFillTo<STM32::WorkingMode::DMA, STM32::SpiFillByte<0xFF>>(page, [](){
+ *     // RX complete - page filled
+ * });
+ *
+ * // 7. Transmit while draining and discarding MISO
+ * spi.TransmitWithDiscard(tx_data, [](){
+ *     // Last byte fully clocked out
+ * });
+ *
+ * // 8. Hardware CRC-16-CCITT, appended on transmit and checked on receive
+ * spi.EnableCrc<STM32::SpiCrcPolynomial<0x1021>>();
+ * spi.ReceiveTo(rx_data, [&spi](){
+ *     if (spi.HasCrcError()) {
+ *         // Received CRC does not match, discard rx_data
+ *     }
+ * });
  * @endcode
  */
 template <IsWorkingMode WorkingModeT, __Internal::__IsUniqueTag UniqueTagT>
@@ -160,6 +280,10 @@ class Spi {
         SPI_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
         HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_TX_RX_COMPLETE_CB_ID
     >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        SPI_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_ERROR_CB_ID
+    >;
 public:
 
     /**
@@ -173,7 +297,8 @@ public:
       : m_handle{handle},
         m_transmit_complete_callback{handle},
         m_receive_complete_callback{handle},
-        m_transmit_receive_complete_callback{handle}
+        m_transmit_receive_complete_callback{handle},
+        m_error_callback{handle}
     { }
 
     /**
@@ -202,6 +327,81 @@ public:
         return std::forward<decltype(self)>(self).m_handle;
     }
 
+    /* =========================== CRC Operations =========================== */
+
+    /**
+     * @brief Enable hardware CRC calculation.
+     * 
+     * The CRC is appended to every transmitted block and the CRC following every
+     * received block is checked by the peripheral. Buffers hold only the payload,
+     * the CRC bytes are handled by hardware.
+     * 
+     * @tparam PolynomialT      CRC polynomial (e.g., SpiCrcPolynomial<0x1021>).
+     * @tparam CrcLengthV       CRC length (default is the SPI data size).
+     *                          Only on devices with configurable CRC length.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note The SPI is re-initialized, call only while no transfer is in progress.
+     * @note A CRC mismatch fails blocking operations and is reported by
+     *       HasCrcError() in the completion callback of non-blocking operations.
+     */
+    template <
+        IsSpiCrcPolynomial PolynomialT
+#if defined(SPI_CRC_LENGTH_DATASIZE)
+        , SpiCrcLength CrcLengthV = SpiCrcLength::DataSize
+#endif /* SPI_CRC_LENGTH_DATASIZE */
+    >
+    bool EnableCrc() noexcept
+    {
+        m_handle.Init.CRCCalculation = SPI_CRCCALCULATION_ENABLE;
+        m_handle.Init.CRCPolynomial = PolynomialT::value;
+#if defined(SPI_CRC_LENGTH_DATASIZE)
+        m_handle.Init.CRCLength = std::to_underlying(CrcLengthV);
+#endif /* SPI_CRC_LENGTH_DATASIZE */
+        return (HAL_OK == HAL_SPI_Init(&m_handle));
+    }
+
+    /**
+     * @brief Disable hardware CRC calculation.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note The SPI is re-initialized, call only while no transfer is in progress.
+     */
+    bool DisableCrc() noexcept
+    {
+        m_handle.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+        return (HAL_OK == HAL_SPI_Init(&m_handle));
+    }
+
+    /**
+     * @returns True if the last transfer failed the hardware CRC check, false otherwise.
+     */
+    [[nodiscard]]
+    bool HasCrcError() const noexcept
+    {
+        return (HAL_SPI_GetError(&m_handle) & HAL_SPI_ERROR_CRC) != 0;
+    }
+
+    /**
+     * @returns True if the last transfer failed (e.g., DMA, overrun, mode fault or CRC error), false otherwise.
+     */
+    [[nodiscard]]
+    bool HasError() const noexcept
+    {
+        return GetError() != HAL_SPI_ERROR_NONE;
+    }
+
+    /**
+     * @returns HAL error code of the last transfer (HAL_SPI_ERROR_* flags), HAL_SPI_ERROR_NONE on success.
+     */
+    [[nodiscard]]
+    std::uint32_t GetError() const noexcept
+    {
+        return HAL_SPI_GetError(&m_handle);
+    }
+
     /* ======================== Receive Operations ======================== */
 
     /**
@@ -239,7 +439,7 @@ public:
      * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
      * 
      * @param rx_message        A contiguous range to store the received data.
-     * @param complete_callback Callback function to be called upon completion.
+     * @param complete_callback Callback function to be called upon completion or error.
      * 
      * @returns True on success, false otherwise.
      * 
@@ -257,6 +457,7 @@ public:
         m_receive_complete_callback.Set(
             std::move(complete_callback)
         );
+        ForwardErrorTo<ReceiveCompleteCallbackT>();
         if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
             return (HAL_OK == HAL_SPI_Receive_IT(
                 &m_handle,
@@ -264,10 +465,21 @@ public:
                 __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
             ));
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
+            if (!RestoreDmaMemoryIncrement()) {
+                return false;
+            }
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+                std::ranges::size(rx_message)
+            );
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            m_receive_complete_callback.SetInvalidateRegion(*invalidate_region);
             return (HAL_OK == HAL_SPI_Receive_DMA(
                 &m_handle,
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
+                size
             ));
         }
     }
@@ -309,7 +521,7 @@ public:
      * @tparam TxWorkingModeT    Working mode for transmitting (default is WorkingModeT).
      * 
      * @param tx_message         A contiguous range containing the data to transmit.
-     * @param complete_callback  Callback function to be called upon completion.
+     * @param complete_callback  Callback function to be called upon completion or error.
      * 
      * @returns True on success, false otherwise.
      * 
@@ -327,6 +539,7 @@ public:
         m_transmit_complete_callback.Set(
             std::move(complete_callback)
         );
+        ForwardErrorTo<TransmitCompleteCallbackT>();
         if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
             return (HAL_OK == HAL_SPI_Transmit_IT(
                 &m_handle,
@@ -334,10 +547,17 @@ public:
                 __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
             ));
         } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+            if (!RestoreDmaMemoryIncrement()) {
+                return false;
+            }
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+                std::ranges::size(tx_message)
+            );
+            __Internal::__PrepareDmaTransmit(tx_message, size);
             return (HAL_OK == HAL_SPI_Transmit_DMA(
                 &m_handle,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
+                size
             ));
         }
     }
@@ -395,7 +615,7 @@ public:
      * 
      * @param tx_message        A contiguous range containing the data to transmit.
      * @param rx_message        A contiguous range to store the received data.
-     * @param complete_callback Callback function to be called upon completion.
+     * @param complete_callback Callback function to be called upon completion or error.
      * 
      * @returns True on success, false otherwise.
      * 
@@ -417,6 +637,7 @@ public:
         m_transmit_receive_complete_callback.Set(
             std::move(complete_callback)
         );
+        ForwardErrorTo<TransmitReceiveCompleteCallbackT>();
         const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
             std::min(std::ranges::size(tx_message), std::ranges::size(rx_message))
         );
@@ -428,6 +649,15 @@ public:
                 size
             ));
         } else if constexpr (std::same_as<TxRxWorkingModeT, WorkingMode::DMA>) {
+            if (!RestoreDmaMemoryIncrement()) {
+                return false;
+            }
+            __Internal::__PrepareDmaTransmit(tx_message, size);
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            m_transmit_receive_complete_callback.SetInvalidateRegion(*invalidate_region);
             return (HAL_OK == HAL_SPI_TransmitReceive_DMA(
                 &m_handle,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
@@ -437,11 +667,301 @@ public:
         }
     }
 
+    /* ================ Receive-Only / Transmit-Only Operations ================ */
+
+    /**
+     * @brief Receive data while clocking out a constant fill byte in blocking mode.
+     * 
+     * The receive buffer is pre-filled with the fill byte and used as its own
+     * transmit buffer, so no separate dummy TX buffer is required.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * @tparam FillByteT        Byte transmitted on MOSI while receiving (default is 0xFF).
+     * @tparam TimeoutV         Timeout for blocking mode (default is 100ms).
+     * 
+     * @param rx_message        A contiguous range to store the received data.
+     * 
+     * @returns True on success, false otherwise.
+     *
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT,
+        IsSpiFillByte FillByteT = SpiFillByte<0xFF>,
+        IsSpiTimeout TimeoutV = SpiTimeout<100>
+    >
+    bool ReceiveWithFillTo(
+        IsSpiMessage auto& rx_message
+    ) noexcept
+    requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
+    {
+        std::ranges::fill(rx_message, FillByteT::value);
+        return (HAL_OK == HAL_SPI_TransmitReceive(
+            &m_handle,
+            std::ranges::data(rx_message),
+            std::ranges::data(rx_message),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            TimeoutV::value
+        ));
+    }
+
+    /**
+     * @brief Receive data while clocking out a constant fill byte in non-blocking mode.
+     * 
+     * In DMA mode the TX stream is switched to a non-incrementing transfer from a
+     * single fill byte, so neither a dummy TX buffer nor a memset is needed and
+     * both DMA directions run at full speed. In interrupt mode the receive buffer
+     * is pre-filled and used as its own transmit buffer.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * @tparam FillByteT        Byte transmitted on MOSI while receiving (default is 0xFF).
+     * 
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called upon completion or error.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note The DMA memory increment setting is restored by the next regular DMA operation.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT,
+        IsSpiFillByte FillByteT = SpiFillByte<0xFF>
+    >
+    bool ReceiveWithFillTo(
+        IsSpiMessage auto& rx_message,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_transmit_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        ForwardErrorTo<TransmitReceiveCompleteCallbackT>();
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(rx_message)
+        );
+        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
+            std::ranges::fill(rx_message, FillByteT::value);
+            return (HAL_OK == HAL_SPI_TransmitReceive_IT(
+                &m_handle,
+                std::ranges::data(rx_message),
+                std::ranges::data(rx_message),
+                size
+            ));
+        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
+#if defined(DMA_MINC_DISABLE)
+            m_dma_fill_byte[0] = FillByteT::value;
+            if (!SetDmaMemoryIncrement(m_handle.hdmatx, DMA_MINC_DISABLE) ||
+                !SetDmaMemoryIncrement(m_handle.hdmarx, DMA_MINC_ENABLE)) {
+                return false;
+            }
+            __Internal::__PrepareDmaTransmit(m_dma_fill_byte, m_dma_fill_byte.size());
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            m_transmit_receive_complete_callback.SetInvalidateRegion(*invalidate_region);
+            return (HAL_OK == HAL_SPI_TransmitReceive_DMA(
+                &m_handle,
+                m_dma_fill_byte.data(),
+                std::ranges::data(rx_message),
+                size
+            ));
+#else /* DMA_MINC_DISABLE */
+            std::ranges::fill(rx_message, FillByteT::value);
+            __Internal::__PrepareDmaTransmit(rx_message, size);
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            m_transmit_receive_complete_callback.SetInvalidateRegion(*invalidate_region);
+            return (HAL_OK == HAL_SPI_TransmitReceive_DMA(
+                &m_handle,
+                std::ranges::data(rx_message),
+                std::ranges::data(rx_message),
+                size
+            ));
+#endif /* DMA_MINC_DISABLE */
+        }
+    }
+
+    /**
+     * @brief Transmit data while discarding the received data in blocking mode.
+     * 
+     * @tparam TxWorkingModeT   Working mode for transmitting (default is WorkingModeT).
+     * @tparam TimeoutV         Timeout for blocking mode (default is 100ms).
+     * 
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note In blocking mode HAL already drains and discards MISO, this is
+     *       equivalent to Transmit().
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT,
+        IsSpiTimeout TimeoutV = SpiTimeout<100>
+    >
+    bool TransmitWithDiscard(
+        const IsSpiMessage auto& tx_message
+    ) noexcept
+    requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
+    {
+        return Transmit<TxWorkingModeT, TimeoutV>(tx_message);
+    }
+
+    /**
+     * @brief Transmit data while discarding the received data in non-blocking mode.
+     * 
+     * In DMA mode the RX stream drains MISO into a single byte with a
+     * non-incrementing transfer. The completion callback therefore fires once
+     * the last byte has been fully clocked, without an RX receive buffer and
+     * without the end-of-transfer busy wait of a TX-only DMA transfer.
+     * In interrupt mode this is equivalent to Transmit().
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param tx_message         A contiguous range containing the data to transmit.
+     * @param complete_callback  Callback function to be called upon completion or error.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note The DMA memory increment setting is restored by the next regular DMA operation.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool TransmitWithDiscard(
+        const IsSpiMessage auto& tx_message,
+        CallbackT&& complete_callback = [](){}
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
+            return Transmit<TxWorkingModeT>(tx_message, std::move(complete_callback));
+        } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+#if defined(DMA_MINC_DISABLE)
+            m_transmit_receive_complete_callback.Set(
+                std::move(complete_callback)
+            );
+            ForwardErrorTo<TransmitReceiveCompleteCallbackT>();
+            if (!SetDmaMemoryIncrement(m_handle.hdmatx, DMA_MINC_ENABLE) ||
+                !SetDmaMemoryIncrement(m_handle.hdmarx, DMA_MINC_DISABLE)) {
+                return false;
+            }
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+                std::ranges::size(tx_message)
+            );
+            __Internal::__PrepareDmaTransmit(tx_message, size);
+            return (HAL_OK == HAL_SPI_TransmitReceive_DMA(
+                &m_handle,
+                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+                m_dma_discard_byte.data(),
+                size
+            ));
+#else /* DMA_MINC_DISABLE */
+            return Transmit<TxWorkingModeT>(tx_message, std::move(complete_callback));
+#endif /* DMA_MINC_DISABLE */
+        }
+    }
+
 private:
     SPI_HandleTypeDef& m_handle;
     TransmitCompleteCallbackT m_transmit_complete_callback;
     ReceiveCompleteCallbackT m_receive_complete_callback;
     TransmitReceiveCompleteCallbackT m_transmit_receive_complete_callback;
+    ErrorCallbackT m_error_callback;
+    DmaBuffer<std::uint8_t, 1> m_dma_fill_byte{};
+    DmaBuffer<std::uint8_t, 1> m_dma_discard_byte{};
+
+    /**
+     * @brief Route the HAL error callback to the completion callback of the started operation.
+     * 
+     * HAL reports failed transfers (DMA, overrun, mode fault, CRC) through the
+     * error callback instead of the completion callback. The completion
+     * callback is invoked on error as well, so a non-blocking operation always
+     * ends with its callback and the user can check HasError().
+     * 
+     * @tparam CompleteCallbackT    Completion callback manager of the started operation.
+     */
+    template <typename CompleteCallbackT>
+    void ForwardErrorTo() noexcept
+    {
+        m_error_callback.Set([](){
+            CompleteCallbackT::Invoke(nullptr);
+        });
+    }
+
+    /**
+     * @brief Restore memory increment on both DMA streams for regular transfers.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool RestoreDmaMemoryIncrement() noexcept
+    {
+#if defined(DMA_MINC_ENABLE)
+        return SetDmaMemoryIncrement(m_handle.hdmatx, DMA_MINC_ENABLE) &&
+               SetDmaMemoryIncrement(m_handle.hdmarx, DMA_MINC_ENABLE);
+#else /* DMA_MINC_ENABLE */
+        return true;
+#endif /* DMA_MINC_ENABLE */
+    }
+
+#if defined(DMA_MINC_ENABLE)
+    /**
+     * @brief Set the memory increment mode of a DMA stream, re-initializing it only on change.
+     * 
+     * @param dma_handle        DMA handle linked to the SPI (may be null if not linked).
+     * @param memory_increment  DMA_MINC_ENABLE or DMA_MINC_DISABLE.
+     * 
+     * @returns True on success (or no DMA linked), false otherwise.
+     * 
+     * @note Fails without touching the stream while a transfer is in progress,
+     *       re-initializing a running stream would corrupt that transfer.
+     */
+    bool SetDmaMemoryIncrement(
+        DMA_HandleTypeDef* dma_handle,
+        std::uint32_t memory_increment
+    ) noexcept
+    {
+        if (dma_handle == nullptr || dma_handle->Init.MemInc == memory_increment) {
+            return true;
+        }
+        if (m_handle.State != HAL_SPI_STATE_READY) {
+            return false;
+        }
+        dma_handle->Init.MemInc = memory_increment;
+        return (HAL_OK == HAL_DMA_Init(dma_handle));
+    }
+#endif /* DMA_MINC_ENABLE */
+};
+
+/**
+ * @brief IsSpi, A concept to check if a type is a Spi.
+ * 
+ * Used by device drivers built on top of Spi.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * using MySpi = STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG>;
+ * static_assert(STM32::IsSpi<MySpi>);
+ * static_assert(!STM32::IsSpi<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpi = requires(T& spi) {
+    { spi.GetHandle() } -> std::same_as<SPI_HandleTypeDef&>;
+    { spi.HasError() } -> std::same_as<bool>;
 };
 
 } /* namespace STM32 */
@@ -0,0 +1,488 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_SPI_ADC_HPP
+#define STM32_SPI_ADC_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "DmaBuffer.hpp"
+#include "Gpio.hpp"
+#include "Spi.hpp"
+#include "Timer.hpp"
+
+namespace STM32 {
+
+/**
+ * @struct SpiAdcFrameSize, A utility struct to hold the number of bytes read per conversion.
+ *
+ * @tparam FrameSizeV   Bytes clocked per data-ready event
+ *                      (e.g., 3 for ADS1256, (channels + 1) * 3 for ADS131M0x).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * using Ads1256Frame = STM32::SpiAdcFrameSize<3>;
+ * auto size = Ads1256Frame::value; // size is 3.
+ * @endcode
+ */
+template <std::size_t FrameSizeV>
+struct SpiAdcFrameSize : __Internal::__Constant<std::size_t, FrameSizeV> {
+    static_assert(
+        FrameSizeV > 0,
+        "Frame size must be greater than zero"
+    );
+};
+
+/**
+ * @brief IsSpiAdcFrameSize, A concept to check if a type is a SpiAdcFrameSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * static_assert(STM32::IsSpiAdcFrameSize<STM32::SpiAdcFrameSize<3>>);
+ * static_assert(!STM32::IsSpiAdcFrameSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiAdcFrameSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0;
+
+/**
+ * @struct SpiAdcBlockSize, A utility struct to hold the number of frames per block.
+ *
+ * @tparam BlockSizeV   Frames collected before a block is handed to the application.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * using MyBlock = STM32::SpiAdcBlockSize<300>; // 10 ms at 30 kSPS
+ * auto size = MyBlock::value; // size is 300.
+ * @endcode
+ */
+template <std::size_t BlockSizeV>
+struct SpiAdcBlockSize : __Internal::__Constant<std::size_t, BlockSizeV> {
+    static_assert(
+        BlockSizeV > 0,
+        "Block size must be greater than zero"
+    );
+};
+
+/**
+ * @brief IsSpiAdcBlockSize, A concept to check if a type is a SpiAdcBlockSize.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * static_assert(STM32::IsSpiAdcBlockSize<STM32::SpiAdcBlockSize<300>>);
+ * static_assert(!STM32::IsSpiAdcBlockSize<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiAdcBlockSize =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    T::value > 0;
+
+/**
+ * @brief Decode a 24-bit big-endian two's complement sample.
+ *
+ * Sample format of ADS1256, ADS131 and most delta-sigma converters.
+ *
+ * @param sample    Three bytes, most significant first.
+ *
+ * @returns Sign-extended sample value.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * static_assert(STM32::SpiAdcDecode24(std::array<std::uint8_t, 3>{0xFF, 0xFF, 0xFF}) == -1);
+ * @endcode
+ */
+[[nodiscard]]
+constexpr std::int32_t SpiAdcDecode24(std::span<const std::uint8_t, 3> sample) noexcept
+{
+    const auto raw = (static_cast<std::uint32_t>(sample[0]) << 16) |
+                     (static_cast<std::uint32_t>(sample[1]) << 8) |
+                     static_cast<std::uint32_t>(sample[2]);
+    return static_cast<std::int32_t>(raw ^ 0x800000U) - 0x800000;
+}
+
+/**
+ * @class SpiAdcBlock, A block of frames read from an external SPI ADC.
+ *
+ * @tparam FrameSizeT   Bytes per frame.
+ * @tparam BlockSizeT   Frames per block.
+ */
+template <IsSpiAdcFrameSize FrameSizeT, IsSpiAdcBlockSize BlockSizeT>
+class SpiAdcBlock {
+public:
+
+    /**
+     * @returns Number of frames in the block.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Size() noexcept
+    {
+        return BlockSizeT::value;
+    }
+
+    /**
+     * @brief Access a raw frame without bounds checking.
+     *
+     * @param index     Frame index.
+     *
+     * @returns Bytes of the frame, in the order they were received.
+     */
+    [[nodiscard]]
+    std::span<const std::uint8_t, FrameSizeT::value> Frame(std::size_t index) const noexcept
+    {
+        return std::span<const std::uint8_t, FrameSizeT::value>{
+            m_frames.data() + index * FrameSizeT::value, FrameSizeT::value
+        };
+    }
+
+    /**
+     * @brief Access a frame timestamp without bounds checking.
+     *
+     * @param index     Frame index.
+     *
+     * @returns Timer counter value latched when data-ready was asserted.
+     */
+    [[nodiscard]]
+    std::uint32_t Timestamp(std::size_t index) const noexcept
+    {
+        return m_timestamps[index];
+    }
+
+private:
+    template <IsSpi, IsSpiAdcFrameSize, IsSpiAdcBlockSize, IsSpiFillByte>
+    friend class SpiAdcAcquisition;
+
+    std::array<std::uint8_t, FrameSizeT::value * BlockSizeT::value> m_frames{};
+    std::array<std::uint32_t, BlockSizeT::value> m_timestamps{};
+};
+
+/**
+ * @class SpiAdcAcquisition, Data-ready driven sample acquisition from an external SPI ADC.
+ *
+ * Every data-ready (DRDY) interrupt latches a timestamp from a free-running
+ * Timer and starts a DMA read of one frame, clocking out a constant fill byte.
+ * The DMA completion copies the frame into the active block of a double
+ * buffer. When a block is full, the block-ready callback is invoked and
+ * acquisition continues into the other block while the application processes
+ * the ready one. The CPU only runs two short interrupts per frame.
+ *
+ * If the application has not released the ready block when the next block is
+ * full, that block is dropped and overwritten, and a dropped block is counted.
+ * A data-ready event while the previous read is still in progress, and a read
+ * that fails on the SPI, are counted as a missed frame.
+ *
+ * @tparam SpiT         Spi type (any working mode, reads always use DMA).
+ * @tparam FrameSizeT   Bytes per frame (e.g., SpiAdcFrameSize<3>).
+ * @tparam BlockSizeT   Frames per block (e.g., SpiAdcBlockSize<300>).
+ * @tparam FillByteT    Byte clocked out during reads (default is 0x00, a no-op
+ *                      command on ADS1256/ADS131).
+ *
+ * @note SpiAdcAcquisition class is non-copyable and non-movable.
+ * @note The ADC must already be configured for continuous conversion
+ *       (e.g., ADS1256 RDATAC) before Start() is called.
+ * @note SPI clock must be high enough to read a frame within one conversion period.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/SpiAdc.hpp>
+ *
+ * SPI_HandleTypeDef hspi1; // Assume properly initialized with DMA by CubeMX
+ * TIM_HandleTypeDef htim2; // Assume free-running at 1 MHz
+ *
+ * extern "C" void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterrupt::Dispatch(GPIO_Pin);
+ * }
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi1};
+ * STM32::GpioInterrupt drdy{GPIOB, GPIO_PIN_0}; // EXTI falling edge
+ * STM32::GpioOutput cs{GPIOA, GPIO_PIN_4};
+ * STM32::Timer timer{htim2};
+ *
+ * STM32::SpiAdcAcquisition<
+ *     decltype(spi), STM32::SpiAdcFrameSize<3>, STM32::SpiAdcBlockSize<300>
+ * > adc{spi, drdy, timer, cs};
+ *
+ * adc.Start([](){
+ *     // Block ready, called in interrupt context
+ * });
+ *
+ * while (true) {
+ *     if (const auto* block = adc.GetReadyBlock()) {
+ *         for (std::size_t i = 0; i < block->Size(); ++i) {
+ *             auto value = STM32::SpiAdcDecode24(block->Frame(i));
+ *             auto time = block->Timestamp(i);
+ *         }
+ *         adc.ReleaseBlock();
+ *     }
+ * }
+ * @endcode
+ */
+template <
+    IsSpi SpiT,
+    IsSpiAdcFrameSize FrameSizeT,
+    IsSpiAdcBlockSize BlockSizeT,
+    IsSpiFillByte FillByteT = SpiFillByte<0x00>
+>
+class SpiAdcAcquisition {
+public:
+    using BlockT = SpiAdcBlock<FrameSizeT, BlockSizeT>;
+
+    /**
+     * @brief Construct SpiAdcAcquisition class with a chip select pin.
+     *
+     * @param spi           Reference to the Spi connected to the ADC.
+     * @param data_ready    Reference to the EXTI pin connected to DRDY.
+     * @param timer         Reference to a free-running Timer used for timestamps.
+     * @param chip_select   Reference to the GPIO output connected to CS (active low).
+     */
+    SpiAdcAcquisition(
+        SpiT& spi,
+        GpioInterrupt& data_ready,
+        Timer& timer,
+        GpioOutput& chip_select
+    ) noexcept
+      : m_spi{spi},
+        m_data_ready{data_ready},
+        m_timer{timer},
+        m_chip_select{&chip_select}
+    {
+        m_chip_select->High();
+    }
+
+    /**
+     * @brief Construct SpiAdcAcquisition class with CS tied low.
+     *
+     * @param spi           Reference to the Spi connected to the ADC.
+     * @param data_ready    Reference to the EXTI pin connected to DRDY.
+     * @param timer         Reference to a free-running Timer used for timestamps.
+     */
+    SpiAdcAcquisition(
+        SpiT& spi,
+        GpioInterrupt& data_ready,
+        Timer& timer
+    ) noexcept
+      : m_spi{spi},
+        m_data_ready{data_ready},
+        m_timer{timer},
+        m_chip_select{nullptr}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    SpiAdcAcquisition(const SpiAdcAcquisition&) = delete;
+    SpiAdcAcquisition& operator=(const SpiAdcAcquisition&) = delete;
+    SpiAdcAcquisition(SpiAdcAcquisition&&) = delete;
+    SpiAdcAcquisition& operator=(SpiAdcAcquisition&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the SpiAdcAcquisition object, stops acquisition.
+     */
+    ~SpiAdcAcquisition()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Start acquisition on the next data-ready event.
+     *
+     * @param block_ready_callback  Callback function to be called when a block is ready.
+     *
+     * @returns True on success, false if a frame read is still in progress
+     *          (e.g., right after Stop()), retry once it completed.
+     */
+    bool Start(CallbackT&& block_ready_callback = [](){}) noexcept
+    {
+        {
+            __Internal::__CriticalSection guard{};
+            if (m_busy.load(std::memory_order_acquire)) {
+                return false;
+            }
+            m_block_ready_callback = std::move(block_ready_callback);
+            m_active_block = 0;
+            m_frame_index = 0;
+            m_ready_block.store(no_block, std::memory_order_release);
+            m_running.store(true, std::memory_order_release);
+        }
+        m_data_ready.Enable([this](){
+            OnDataReady();
+        });
+        return true;
+    }
+
+    /**
+     * @brief Stop acquisition.
+     *
+     * @note A read in progress completes, its frame is discarded.
+     */
+    void Stop() noexcept
+    {
+        m_data_ready.Disable();
+        m_running.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @returns Pointer to the block ready for processing, nullptr if none.
+     */
+    [[nodiscard]]
+    const BlockT* GetReadyBlock() const noexcept
+    {
+        const auto index = m_ready_block.load(std::memory_order_acquire);
+        return (index == no_block) ? nullptr : &m_blocks[index];
+    }
+
+    /**
+     * @brief Hand the ready block back for acquisition.
+     */
+    void ReleaseBlock() noexcept
+    {
+        m_ready_block.store(no_block, std::memory_order_release);
+    }
+
+    /**
+     * @returns Number of frames missed because a read was still in progress or failed.
+     */
+    [[nodiscard]]
+    std::uint32_t GetMissedFrameCount() const noexcept
+    {
+        return m_missed_frames.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns Number of blocks dropped because the ready block was not released in time.
+     */
+    [[nodiscard]]
+    std::uint32_t GetDroppedBlockCount() const noexcept
+    {
+        return m_dropped_blocks.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t no_block{2};
+
+    SpiT& m_spi;
+    GpioInterrupt& m_data_ready;
+    Timer& m_timer;
+    GpioOutput* m_chip_select;
+    CallbackT m_block_ready_callback{};
+    DmaBuffer<std::uint8_t, FrameSizeT::value> m_frame{};
+    std::array<BlockT, 2> m_blocks{};
+    std::size_t m_active_block{0};
+    std::size_t m_frame_index{0};
+    std::uint32_t m_frame_timestamp{0};
+    std::atomic<std::size_t> m_ready_block{no_block};
+    std::atomic<bool> m_busy{false};
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint32_t> m_missed_frames{0};
+    std::atomic<std::uint32_t> m_dropped_blocks{0};
+
+    /**
+     * @brief Latch the timestamp and start reading a frame.
+     */
+    void OnDataReady() noexcept
+    {
+        const auto timestamp = m_timer.Get();
+        if (m_busy.load(std::memory_order_acquire)) {
+            CountMissedFrame();
+            return;
+        }
+        m_busy.store(true, std::memory_order_release);
+        m_frame_timestamp = timestamp;
+        if (m_chip_select) {
+            m_chip_select->Low();
+        }
+        const bool started = m_spi.template ReceiveWithFillTo<WorkingMode::DMA, FillByteT>(
+            m_frame,
+            [this](){
+                OnFrameComplete();
+            }
+        );
+        if (!started) {
+            if (m_chip_select) {
+                m_chip_select->High();
+            }
+            m_busy.store(false, std::memory_order_release);
+            CountMissedFrame();
+        }
+    }
+
+    /**
+     * @brief Count a missed frame, called from both the EXTI and the DMA interrupts.
+     */
+    void CountMissedFrame() noexcept
+    {
+        __Internal::__CriticalSection guard{};
+        m_missed_frames.store(GetMissedFrameCount() + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Store the received frame and hand over the block when full.
+     *
+     * Frames completing after Stop() and failed reads are discarded.
+     */
+    void OnFrameComplete() noexcept
+    {
+        if (m_chip_select) {
+            m_chip_select->High();
+        }
+        if (!m_running.load(std::memory_order_acquire)) {
+            m_busy.store(false, std::memory_order_release);
+            return;
+        }
+        if (m_spi.HasError()) {
+            m_busy.store(false, std::memory_order_release);
+            CountMissedFrame();
+            return;
+        }
+        auto& block = m_blocks[m_active_block];
+        std::ranges::copy(
+            m_frame,
+            block.m_frames.begin() + m_frame_index * FrameSizeT::value
+        );
+        block.m_timestamps[m_frame_index] = m_frame_timestamp;
+        m_busy.store(false, std::memory_order_release);
+        if (++m_frame_index < BlockSizeT::value) {
+            return;
+        }
+        m_frame_index = 0;
+        if (m_ready_block.load(std::memory_order_acquire) != no_block) {
+            m_dropped_blocks.store(GetDroppedBlockCount() + 1, std::memory_order_relaxed);
+            return;
+        }
+        m_ready_block.store(m_active_block, std::memory_order_release);
+        m_active_block ^= 1;
+        if (m_block_ready_callback) {
+            m_block_ready_callback();
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_SPI_ADC_HPP */
@@ -4,9 +4,12 @@
 #ifndef STM32_TIMER_HPP
 #define STM32_TIMER_HPP
 
+#include <concepts>
 #include <cstdint>
 #include <utility>
 
+#include "__Internal/__Utility.hpp"
+
 #include "main.h"
 
 #if !defined(HAL_TIM_MODULE_ENABLED) /* module check */
@@ -162,6 +165,133 @@ private:
     TIM_HandleTypeDef& m_handle;
 };
 
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+/**
+ * @class PeriodicTimer, A class to invoke a callback on every timer update event.
+ * 
+ * The callback is invoked from the timer update interrupt at the rate configured
+ * by the timer's prescaler and period (e.g., a 1 kHz refresh tick).
+ * 
+ * @tparam UniqueTagT   Unique tag type to differentiate multiple PeriodicTimer instances.
+ *                      UniqueTagT must be STM32_UNIQUE_TAG.
+ * 
+ * @note PeriodicTimer class is non-copyable and non-movable.
+ * @note Requires USE_HAL_TIM_REGISTER_CALLBACKS and the timer update interrupt enabled in NVIC.
+ * @note Timer stops on destruction.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Timer.hpp>
+ *
+ * TIM_HandleTypeDef htim6; // Assume properly initialized (e.g., 1 kHz update rate)
+ * 
+ * STM32::PeriodicTimer<STM32_UNIQUE_TAG> tick{htim6};
+ * tick.Start([](){
+ *     // Called every 1 ms from the TIM6 interrupt
+ * });
+ * tick.Stop();
+ * @endcode
+ */
+template <__Internal::__IsUniqueTag UniqueTagT>
+class PeriodicTimer {
+    using PeriodElapsedCallbackT = __Internal::__CallbackManager<
+        TIM_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_TIM_RegisterCallback, HAL_TIM_UnRegisterCallback, HAL_TIM_PERIOD_ELAPSED_CB_ID
+    >;
+public:
+
+    /**
+     * @brief Construct PeriodicTimer class.
+     * 
+     * @param handle    Reference to the TIM handle.
+     *
+     * @note The timer is not started until Start() is called.
+     */
+    explicit PeriodicTimer(TIM_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_period_elapsed_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    PeriodicTimer(const PeriodicTimer&) = delete;
+    PeriodicTimer& operator=(const PeriodicTimer&) = delete;
+    PeriodicTimer(PeriodicTimer&&) = delete;
+    PeriodicTimer& operator=(PeriodicTimer&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the PeriodicTimer object, stops the timer.
+     */
+    ~PeriodicTimer()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns TIM handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Start the timer and invoke the callback on every update event.
+     * 
+     * @param period_callback   Callback function to be called on every update event.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Start(CallbackT&& period_callback) noexcept
+    {
+        m_period_elapsed_callback.Set(
+            std::move(period_callback)
+        );
+        return (HAL_OK == HAL_TIM_Base_Start_IT(&m_handle));
+    }
+
+    /**
+     * @brief Stop the timer.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        return (HAL_OK == HAL_TIM_Base_Stop_IT(&m_handle));
+    }
+
+private:
+    TIM_HandleTypeDef& m_handle;
+    PeriodElapsedCallbackT m_period_elapsed_callback;
+};
+
+/**
+ * @brief IsPeriodicTimer, A concept to check if a type is a PeriodicTimer.
+ * 
+ * Used by components triggered at a fixed rate.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Timer.hpp>
+ * 
+ * static_assert(STM32::IsPeriodicTimer<STM32::PeriodicTimer<STM32_UNIQUE_TAG>>);
+ * static_assert(!STM32::IsPeriodicTimer<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsPeriodicTimer = requires(T& timer, CallbackT&& period_callback) {
+    { timer.Start(std::move(period_callback)) } -> std::same_as<bool>;
+    { timer.Stop() } -> std::same_as<bool>;
+    { timer.GetHandle() } -> std::same_as<TIM_HandleTypeDef&>;
+};
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+
 } /* namespace STM32 */
 
 #endif /* STM32_TIMER_HPP */
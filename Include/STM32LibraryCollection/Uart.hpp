@@ -12,6 +12,7 @@
 #include <ranges>
 
 #include "Config.hpp"
+#include "DmaBuffer.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -106,6 +107,8 @@ concept IsUartMessage = __Internal::__IsMessage<T, char>;
  *                              UniqueTagT must be STM32_UNIQUE_TAG.
  *
  * @note Uart class is non-copyable and non-movable.
+ * @note On cores with data cache, DMA receive buffers must be DmaBuffer, cache
+ *       maintenance is performed automatically on the transferred range.
  *
  * @example Usage:
  * @code {.cpp}
@@ -254,10 +257,18 @@ public:
                 __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
             ));
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>){
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+                std::ranges::size(rx_message)
+            );
+            const auto invalidate_region = __Internal::__PrepareDmaReceive(rx_message, size);
+            if (!invalidate_region) {
+                return false;
+            }
+            m_receive_complete_callback.SetInvalidateRegion(*invalidate_region);
             return (HAL_OK == HAL_UART_Receive_DMA(
                 &m_handle,
                 reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
+                size
             ));
         }
     }
@@ -328,12 +339,16 @@ public:
                 __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
             ));
         } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>){
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+                std::ranges::size(tx_message)
+            );
+            __Internal::__PrepareDmaTransmit(tx_message, size);
             return (HAL_OK == HAL_UART_Transmit_DMA(
                 &m_handle,
                 reinterpret_cast<std::uint8_t*>(
                     const_cast<char *>(std::ranges::data(tx_message))
                 ),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
+                size
             ));
         }
     }
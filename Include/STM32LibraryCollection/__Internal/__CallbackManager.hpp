@@ -4,6 +4,7 @@
 #ifndef STM32_CALLBACK_MANAGER_HPP
 #define STM32_CALLBACK_MANAGER_HPP
 
+#include "__DCache.hpp"
 #include "__InplaceFunction.hpp"
 
 namespace STM32 {
@@ -131,6 +132,27 @@ public:
     void Set(CallbackT&& callback) noexcept
     {
         s_callback = std::move(callback);
+#if STM32_DCACHE_PRESENT
+        s_invalidate_region = {};
+#endif /* STM32_DCACHE_PRESENT */
+    }
+
+    /**
+     * @brief Set a DMA receive buffer to invalidate before invoking the callback.
+     * 
+     * On cores with data cache, the region is invalidated when the event fires
+     * so that the callback observes the data written by the DMA. The region is
+     * reset by the next Set() call.
+     * 
+     * @param invalidate_region     Buffer written by the DMA during the operation.
+     * 
+     * @note No-op on cores without data cache.
+     */
+    void SetInvalidateRegion([[maybe_unused]] __DCacheRegion invalidate_region) noexcept
+    {
+#if STM32_DCACHE_PRESENT
+        s_invalidate_region = invalidate_region;
+#endif /* STM32_DCACHE_PRESENT */
     }
 
     /**
@@ -144,12 +166,16 @@ public:
     /**
      * @brief HAL-compatible callback function pointer.
      * 
-     * Automatically registered with HAL. Invokes the stored callback if set.
+     * Automatically registered with HAL. Invalidates the DMA receive region
+     * (if any) and invokes the stored callback if set.
      * 
      * @param handle    Pointer to the peripheral handle (unused).
      */
     static void Invoke([[maybe_unused]] HandleT* handle) noexcept
     {
+#if STM32_DCACHE_PRESENT
+        __InvalidateDCache(s_invalidate_region);
+#endif /* STM32_DCACHE_PRESENT */
         if (s_callback) {
             s_callback();
         }
@@ -158,6 +184,9 @@ public:
 private:
     HandleT& m_handle;
     static inline CallbackT s_callback{};
+#if STM32_DCACHE_PRESENT
+    static inline __DCacheRegion s_invalidate_region{};
+#endif /* STM32_DCACHE_PRESENT */
 };
 
 } /* namespace __Internal */
@@ -0,0 +1,67 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CRITICAL_SECTION_HPP
+#define STM32_CRITICAL_SECTION_HPP
+
+#include <cstdint>
+
+#include "main.h"
+
+namespace STM32::__Internal {
+
+/**
+ * @class __CriticalSection, A RAII guard masking interrupts for its lifetime.
+ * 
+ * Saves PRIMASK and disables interrupts on construction, restores PRIMASK on
+ * destruction. Nesting is safe: an inner guard does not re-enable interrupts
+ * masked by an outer one.
+ * 
+ * @note This is an internal class. Do not use directly in application code.
+ * @note Keep the guarded scope short, it delays every interrupt in the system.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * {
+ *     __Internal::__CriticalSection guard{};
+ *     // Shared state accessed by interrupts
+ * }
+ * @endcode
+ */
+class __CriticalSection {
+public:
+
+    /**
+     * @brief Save PRIMASK and disable interrupts.
+     */
+    __CriticalSection() noexcept
+      : m_primask{__get_PRIMASK()}
+    {
+        __disable_irq();
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __CriticalSection(const __CriticalSection&) = delete;
+    __CriticalSection& operator=(const __CriticalSection&) = delete;
+    __CriticalSection(__CriticalSection&&) = delete;
+    __CriticalSection& operator=(__CriticalSection&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Restore PRIMASK.
+     */
+    ~__CriticalSection()
+    {
+        __set_PRIMASK(m_primask);
+    }
+
+private:
+    std::uint32_t m_primask;
+};
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_CRITICAL_SECTION_HPP */
@@ -0,0 +1,246 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_DCACHE_HPP
+#define STM32_DCACHE_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "main.h"
+
+/**
+ * @def STM32_DCACHE_PRESENT
+ *
+ * @brief 1 if the core has a data cache (Cortex-M7), 0 otherwise.
+ *
+ * Derived from the CMSIS device header. All cache maintenance in this library
+ * is compiled out when this is 0.
+ */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define STM32_DCACHE_PRESENT 1
+#else /* __DCACHE_PRESENT */
+#define STM32_DCACHE_PRESENT 0
+#endif /* __DCACHE_PRESENT */
+
+namespace STM32::__Internal {
+
+/**
+ * @brief Size of a data cache line in bytes.
+ *
+ * @note This is an internal constant. Do not use directly in application code.
+ */
+inline constexpr std::size_t __dcache_line_size{
+#if defined(__SCB_DCACHE_LINE_SIZE)
+    __SCB_DCACHE_LINE_SIZE
+#else /* __SCB_DCACHE_LINE_SIZE */
+    32
+#endif /* __SCB_DCACHE_LINE_SIZE */
+};
+
+/**
+ * @struct __DCacheRegion, A memory region subject to data cache maintenance.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+struct __DCacheRegion {
+    void* data{};
+    std::size_t size{};
+};
+
+/**
+ * @brief __IsDCacheAligned, A concept to check if a buffer type can be safely invalidated.
+ *
+ * On cores with a data cache, invalidating a buffer discards whole cache lines.
+ * A buffer that shares a cache line with other data would silently discard
+ * unrelated CPU writes, so DMA receive buffers must be cache-line aligned and
+ * cache-line padded (see DmaBuffer). Always satisfied on cores without cache.
+ *
+ * Spans are non-owning views, see __IsDCachePaddedSpan and __IsDCacheSpan.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @note This is an internal concept. Do not use directly in application code.
+ */
+template <typename T>
+concept __IsDCacheAligned =
+    (STM32_DCACHE_PRESENT == 0) ||
+    (alignof(T) >= __dcache_line_size && sizeof(T) % __dcache_line_size == 0);
+
+/**
+ * @brief __IsDCacheSpan, A concept to check if a buffer type is a std::span.
+ *
+ * Spans let type-erased users pass buffers of different sizes. Their storage
+ * is unknown at compile time, so __PrepareDmaReceive only accepts them at run
+ * time when they start on a cache line and cover whole cache lines.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @note This is an internal concept. Do not use directly in application code.
+ */
+template <typename T>
+concept __IsDCacheSpan =
+    std::same_as<T, std::span<typename T::element_type, T::extent>>;
+
+/**
+ * @brief __IsDCachePaddedSpan, A concept to check if a buffer type is a span over padded storage.
+ *
+ * Satisfied by DmaSpan, which only DmaBuffer produces: it starts at the cache
+ * line aligned buffer and the lines after its end are the buffer padding.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @note This is an internal concept. Do not use directly in application code.
+ */
+template <typename T>
+concept __IsDCachePaddedSpan =
+    std::derived_from<T, std::span<typename T::element_type, T::extent>> &&
+    T::is_dcache_padded;
+
+#if STM32_DCACHE_PRESENT
+/**
+ * @brief Expand a region to the cache lines covering it.
+ *
+ * @param data      Start of the region.
+ * @param size      Size of the region in bytes.
+ *
+ * @returns Line-aligned start address and line-padded size.
+ */
+[[nodiscard]]
+inline __DCacheRegion __AlignToDCacheLines(const void* data, std::size_t size) noexcept
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(data);
+    const auto start = address & ~(__dcache_line_size - 1);
+    const auto end = (address + size + __dcache_line_size - 1) & ~(__dcache_line_size - 1);
+    return {reinterpret_cast<void*>(start), end - start};
+}
+#endif /* STM32_DCACHE_PRESENT */
+
+/**
+ * @brief Write back the cache lines covering a buffer before a DMA reads it.
+ *
+ * @param data      Start of the buffer.
+ * @param size      Size of the buffer in bytes.
+ *
+ * @note No-op on cores without data cache.
+ */
+inline void __CleanDCache([[maybe_unused]] const void* data, [[maybe_unused]] std::size_t size) noexcept
+{
+#if STM32_DCACHE_PRESENT
+    if (size == 0) {
+        return;
+    }
+    const auto region = __AlignToDCacheLines(data, size);
+    SCB_CleanDCache_by_Addr(
+        reinterpret_cast<std::uint32_t*>(region.data),
+        static_cast<std::int32_t>(region.size)
+    );
+#endif /* STM32_DCACHE_PRESENT */
+}
+
+/**
+ * @brief Discard the cache lines covering a buffer written by a DMA.
+ *
+ * @param data      Start of the buffer.
+ * @param size      Size of the buffer in bytes.
+ *
+ * @note No-op on cores without data cache.
+ * @warning The buffer must not share cache lines with other data (see __IsDCacheAligned).
+ */
+inline void __InvalidateDCache([[maybe_unused]] void* data, [[maybe_unused]] std::size_t size) noexcept
+{
+#if STM32_DCACHE_PRESENT
+    if (size == 0) {
+        return;
+    }
+    const auto region = __AlignToDCacheLines(data, size);
+    SCB_InvalidateDCache_by_Addr(
+        reinterpret_cast<std::uint32_t*>(region.data),
+        static_cast<std::int32_t>(region.size)
+    );
+#endif /* STM32_DCACHE_PRESENT */
+}
+
+/**
+ * @brief Discard the cache lines covering a region written by a DMA.
+ *
+ * @param region    Region to invalidate.
+ *
+ * @note No-op on cores without data cache.
+ */
+inline void __InvalidateDCache(__DCacheRegion region) noexcept
+{
+    __InvalidateDCache(region.data, region.size);
+}
+
+/**
+ * @brief Prepare a buffer for a DMA transmit by writing back its cache lines.
+ *
+ * @param message   Contiguous range read by the DMA.
+ * @param length    Number of elements transferred.
+ *
+ * @note No-op on cores without data cache.
+ */
+inline void __PrepareDmaTransmit(
+    [[maybe_unused]] const std::ranges::contiguous_range auto& message,
+    [[maybe_unused]] std::size_t length
+) noexcept
+{
+    __CleanDCache(
+        std::ranges::data(message),
+        length * sizeof(std::ranges::range_value_t<decltype(message)>)
+    );
+}
+
+/**
+ * @brief Prepare a buffer for a DMA receive by discarding its cache lines.
+ *
+ * Invalidating before the transfer drops dirty lines that would otherwise be
+ * evicted over the DMA data. The returned region must be invalidated again on
+ * completion (see __CallbackManager::SetInvalidateRegion) to drop lines
+ * speculatively refilled during the transfer.
+ *
+ * @param message   Contiguous range written by the DMA.
+ * @param length    Number of elements transferred.
+ *
+ * @returns Region to invalidate on completion, std::nullopt if a std::span
+ *          does not start on a cache line or does not cover whole cache lines.
+ *
+ * @note Fails to compile on cores with data cache if the buffer type is not
+ *       cache-line aligned and padded (use DmaBuffer or DmaBuffer::Span()).
+ */
+[[nodiscard]]
+inline std::optional<__DCacheRegion> __PrepareDmaReceive(
+    std::ranges::contiguous_range auto& message,
+    std::size_t length
+) noexcept
+{
+    using MessageT = std::remove_cvref_t<decltype(message)>;
+    using ValueT = std::ranges::range_value_t<MessageT>;
+    static_assert(
+        __IsDCacheAligned<MessageT> || __IsDCachePaddedSpan<MessageT> || __IsDCacheSpan<MessageT>,
+        "DMA receive buffers must be cache-line aligned and padded on cores "
+        "with data cache, use STM32::DmaBuffer!"
+    );
+    if constexpr (!__IsDCacheAligned<MessageT> && !__IsDCachePaddedSpan<MessageT>) {
+        const auto address = reinterpret_cast<std::uintptr_t>(std::ranges::data(message));
+        if (address % __dcache_line_size != 0 || (length * sizeof(ValueT)) % __dcache_line_size != 0) {
+            return std::nullopt;
+        }
+    }
+    const __DCacheRegion region{
+        std::ranges::data(message),
+        length * sizeof(ValueT)
+    };
+    __InvalidateDCache(region);
+    return region;
+}
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_DCACHE_HPP */
@@ -0,0 +1,179 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_FIXED_POINT_HPP
+#define STM32_FIXED_POINT_HPP
+
+#include <bit>
+#include <cstdint>
+
+namespace STM32::__Internal {
+
+/**
+ * @enum __FixedPointRounding, Rounding applied by __FixedPointScale.
+ *
+ * @note This is an internal enum. Do not use directly in application code.
+ */
+enum class __FixedPointRounding {
+    Down,       /**< Truncate toward zero, like static_cast<std::uint32_t> */
+    Nearest     /**< Round half up, like std::round for non-negative values */
+};
+
+/**
+ * @brief Check if a value is a whole number representable as std::uint32_t.
+ *
+ * @param value     Value to be checked.
+ *
+ * @returns True if value is in [0, 2^32) and has no fractional part.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr bool __IsWholeUint32(double value) noexcept
+{
+    return 0. <= value && value < 4294967296. &&
+           static_cast<double>(static_cast<std::uint32_t>(value)) == value;
+}
+
+/**
+ * @brief Find the number of binary fraction bits of a value.
+ *
+ * @param value     Non-negative value (e.g., 2.5 has 1 fraction bit, 12.25 has 2).
+ * @param max_bits  Largest number of fraction bits searched.
+ *
+ * @returns Smallest bits such that value * 2^bits is whole, max_bits + 1 if none.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr std::uint32_t __FractionBits(double value, std::uint32_t max_bits) noexcept
+{
+    for (std::uint32_t bits{}; bits <= max_bits; ++bits) {
+        if (__IsWholeUint32(value * static_cast<double>(std::uint64_t{1} << bits))) {
+            return bits;
+        }
+    }
+    return max_bits + 1;
+}
+
+/**
+ * @struct __FixedPointScale, Exact rational scaling with a multiply and a shift.
+ *
+ * Evaluates (offset_numerator + value * numerator) / denominator rounded down
+ * or to nearest, for every value in [0, input_max], without division or
+ * floating point. The quotients are stored as fixed-point multipliers rounded
+ * up, with enough fraction bits that the accumulated error stays below the
+ * 1 / denominator spacing of the exact results, so the result is exact.
+ *
+ * @note Requires denominator * (input_max + 1) <= 2^32 (see Fits()) and the
+ *       largest result times 2^shift to fit in 64 bits.
+ * @note This is an internal class. Do not use directly in application code.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * // round(value * 100 / 4095) for 12-bit ADC readings
+ * constexpr auto scale = STM32::__Internal::__FixedPointScale::Make(
+ *     100, 0, 4095, 4095, STM32::__Internal::__FixedPointRounding::Nearest
+ * );
+ * static_assert(scale.Apply(2048) == 50);
+ * @endcode
+ */
+struct __FixedPointScale {
+    std::uint64_t multiplier{};
+    std::uint64_t offset{};
+    std::uint32_t shift{};
+
+    /**
+     * @brief Check if a scaling can be represented exactly.
+     *
+     * @param denominator   Divisor of the scaling.
+     * @param input_max     Largest input value.
+     * @param rounding      Rounding of the result.
+     *
+     * @returns True if the required fraction bits do not exceed 31.
+     */
+    [[nodiscard]]
+    static constexpr bool Fits(
+        std::uint64_t denominator,
+        std::uint64_t input_max,
+        __FixedPointRounding rounding
+    ) noexcept
+    {
+        const std::uint64_t divisor{
+            (rounding == __FixedPointRounding::Nearest) ? 2 * denominator : denominator
+        };
+        return 0 < denominator && divisor <= (std::uint64_t{1} << 31) / (input_max + 1);
+    }
+
+    /**
+     * @brief Precompute the multipliers of a scaling.
+     *
+     * @param numerator         Factor applied to the input.
+     * @param offset_numerator  Constant added before division.
+     * @param denominator       Divisor (at most 2^31).
+     * @param input_max         Largest input value.
+     * @param rounding          Rounding of the result.
+     *
+     * @returns Scaling evaluating round((offset_numerator + value * numerator) / denominator).
+     *
+     * @note Evaluated at compile time for constant arguments, runtime arguments
+     *       cost 64-bit integer divisions once.
+     */
+    [[nodiscard]]
+    static constexpr __FixedPointScale Make(
+        std::uint64_t numerator,
+        std::uint64_t offset_numerator,
+        std::uint64_t denominator,
+        std::uint64_t input_max,
+        __FixedPointRounding rounding
+    ) noexcept
+    {
+        if (rounding == __FixedPointRounding::Nearest) {
+            numerator *= 2;
+            offset_numerator = 2 * offset_numerator + denominator;
+            denominator *= 2;
+        }
+        const std::uint32_t shift{static_cast<std::uint32_t>(
+            std::bit_width(denominator * (input_max + 1) - 1)
+        )};
+        return {
+            Reciprocal(numerator, denominator, shift),
+            Reciprocal(offset_numerator, denominator, shift),
+            shift
+        };
+    }
+
+    /**
+     * @brief Scale a value.
+     *
+     * @param value     Value in [0, input_max].
+     *
+     * @returns Scaled and rounded value.
+     */
+    [[nodiscard]]
+    constexpr std::uint64_t Apply(std::uint32_t value) const noexcept
+    {
+        return (value * multiplier + offset) >> shift;
+    }
+
+private:
+
+    /**
+     * @returns ceil(numerator * 2^shift / denominator) without overflowing the intermediate product.
+     */
+    [[nodiscard]]
+    static constexpr std::uint64_t Reciprocal(
+        std::uint64_t numerator,
+        std::uint64_t denominator,
+        std::uint32_t shift
+    ) noexcept
+    {
+        const std::uint64_t whole{numerator / denominator};
+        const std::uint64_t fraction{numerator % denominator};
+        return (whole << shift) + ((fraction << shift) + denominator - 1) / denominator;
+    }
+};
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_FIXED_POINT_HPP */
@@ -0,0 +1,137 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_LOOKUP_TABLE_HPP
+#define STM32_LOOKUP_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "__Math.hpp"
+
+namespace STM32::__Internal {
+
+/**
+ * @struct __PiecewiseLinearTable, A compile-time sampled function with integer interpolation.
+ *
+ * The function is sampled on a grid of SegmentsV equal segments of 2^shift
+ * inputs covering [0, InputMaxV], so a lookup is a shift, a subtraction,
+ * a multiply and an add. Grid points beyond InputMaxV are linearly
+ * extrapolated from the value at InputMaxV, which keeps the last segment
+ * exact at both of its ends.
+ *
+ * @tparam InputMaxV    Largest input value (e.g., 4095 for 12-bit ADC codes).
+ * @tparam SegmentsV    Number of segments over the power of two input span (a power of two).
+ * @tparam FunctionV    Constexpr callable mapping an input (as double) to an output (as double).
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <std::uint32_t InputMaxV, std::uint32_t SegmentsV, auto FunctionV>
+struct __PiecewiseLinearTable {
+    static_assert(
+        std::has_single_bit(SegmentsV) && SegmentsV <= std::bit_ceil(InputMaxV + std::uint64_t{1}),
+        "Segment count must be a power of two not larger than the input span!"
+    );
+
+    static constexpr std::uint32_t shift{static_cast<std::uint32_t>(
+        std::countr_zero(std::bit_ceil(InputMaxV + std::uint64_t{1}) / SegmentsV)
+    )};
+    static constexpr std::uint64_t width{std::uint64_t{1} << shift};
+    static constexpr std::size_t point_count{(InputMaxV >> shift) + std::size_t{2}};
+
+    /**
+     * @returns Function at the grid points, exact outputs before rounding.
+     */
+    static constexpr std::array<double, point_count> Sample() noexcept
+    {
+        std::array<double, point_count> points{};
+        for (std::size_t i{}; i + 1 < point_count; ++i) {
+            points[i] = static_cast<double>(FunctionV(static_cast<double>(i * width)));
+        }
+        const std::size_t last{point_count - 2};
+        const double last_span{static_cast<double>(InputMaxV - last * width)};
+        points[last + 1] = (last_span == 0.) ? points[last] :
+            points[last] + (static_cast<double>(FunctionV(static_cast<double>(InputMaxV))) - points[last]) *
+                           static_cast<double>(width) / last_span;
+        return points;
+    }
+
+    /**
+     * @returns True if every grid point fits std::int32_t.
+     */
+    static constexpr bool Fits() noexcept
+    {
+        return std::ranges::all_of(Sample(), [](double point){
+            return static_cast<double>(std::numeric_limits<std::int32_t>::min()) <= point &&
+                   point <= static_cast<double>(std::numeric_limits<std::int32_t>::max());
+        });
+    }
+
+    static_assert(
+        Fits(),
+        "Function output does not fit std::int32_t, scale it down!"
+    );
+
+    /**
+     * @returns Grid point outputs rounded to integers.
+     */
+    static constexpr std::array<std::int32_t, point_count> Generate() noexcept
+    {
+        std::array<std::int32_t, point_count> table{};
+        const auto points = Sample();
+        for (std::size_t i{}; i < point_count; ++i) {
+            table[i] = static_cast<std::int32_t>(__RoundToInt64(points[i]));
+        }
+        return table;
+    }
+
+    static constexpr auto table = Generate();
+
+    /**
+     * @brief Interpolate the table.
+     *
+     * @param input     Input value, values above InputMaxV are clamped.
+     *
+     * @returns Interpolated output, rounded to nearest.
+     */
+    [[nodiscard]]
+    static constexpr std::int32_t Lookup(std::uint32_t input) noexcept
+    {
+        input = std::min(input, InputMaxV);
+        const std::uint32_t index{input >> shift};
+        const std::int64_t fraction{static_cast<std::int64_t>(input & (width - 1))};
+        const std::int64_t start{table[index]};
+        const std::int64_t delta{static_cast<std::int64_t>(table[index + 1]) - start};
+        return static_cast<std::int32_t>(
+            start + ((delta * fraction + static_cast<std::int64_t>(width / 2)) >> shift)
+        );
+    }
+
+    /**
+     * @param first     First input checked.
+     * @param last      Last input checked.
+     *
+     * @returns Largest absolute difference between Lookup() and the function over [first, last].
+     *
+     * @note Evaluates the function for every input, use in static_assert only.
+     */
+    [[nodiscard]]
+    static consteval double MaxError(std::uint32_t first, std::uint32_t last) noexcept
+    {
+        double max_error{};
+        for (std::uint64_t input{first}; input <= std::min(last, InputMaxV); ++input) {
+            const double exact{static_cast<double>(FunctionV(static_cast<double>(input)))};
+            const double error{static_cast<double>(Lookup(static_cast<std::uint32_t>(input))) - exact};
+            max_error = std::max(max_error, (error < 0.) ? -error : error);
+        }
+        return max_error;
+    }
+};
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_LOOKUP_TABLE_HPP */
@@ -0,0 +1,102 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_MATH_HPP
+#define STM32_MATH_HPP
+
+#include <cstdint>
+#include <utility>
+
+namespace STM32::__Internal {
+
+/**
+ * @brief Round to the nearest integer, halves away from zero, at compile time.
+ *
+ * @param value     Value to be rounded.
+ *
+ * @returns Rounded value.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr std::int64_t __RoundToInt64(double value) noexcept
+{
+    return (value < 0.) ?
+        -static_cast<std::int64_t>(-value + 0.5) :
+        static_cast<std::int64_t>(value + 0.5);
+}
+
+/**
+ * @brief Integer square root.
+ *
+ * @param value     Radicand.
+ *
+ * @returns floor(sqrt(value)).
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr std::uint32_t __Isqrt(std::uint64_t value) noexcept
+{
+    std::uint64_t root{};
+    std::uint64_t bit{std::uint64_t{1} << 62};
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return static_cast<std::uint32_t>(root);
+}
+
+/**
+ * @brief Cosine and sine of a fraction of a full turn, at compile time.
+ *
+ * The angle is reduced to a quadrant with integer arithmetic, so the results
+ * are exactly symmetric, and evaluated with Taylor series accurate to double
+ * precision on [0, pi/2).
+ *
+ * @param numerator     Angle numerator, the angle is 2 * pi * numerator / denominator.
+ * @param denominator   Angle denominator (non-zero).
+ *
+ * @returns Pair of cosine and sine.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+[[nodiscard]]
+constexpr std::pair<double, double> __CosSinTurn(std::uint64_t numerator, std::uint64_t denominator) noexcept
+{
+    constexpr double half_pi{1.57079632679489661923};
+    numerator %= denominator;
+    const std::uint64_t quadrant{4 * numerator / denominator};
+    const double angle{
+        half_pi * static_cast<double>(4 * numerator - quadrant * denominator) / static_cast<double>(denominator)
+    };
+    double cosine{};
+    double sine{};
+    double term{1.};
+    for (std::uint32_t n{}; n < 30; ++n) {
+        if (n % 2 == 0) {
+            cosine += (n % 4 == 0) ? term : -term;
+        } else {
+            sine += (n % 4 == 1) ? term : -term;
+        }
+        term *= angle / static_cast<double>(n + 1);
+    }
+    switch (quadrant) {
+    case 0: return {cosine, sine};
+    case 1: return {-sine, cosine};
+    case 2: return {-cosine, -sine};
+    default: return {sine, -cosine};
+    }
+}
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_MATH_HPP */
@@ -0,0 +1,253 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_MEDIAN_HPP
+#define STM32_MEDIAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace STM32::__Internal {
+
+/**
+ * @brief Largest size selected with a median network, larger sizes use std::ranges::nth_element.
+ *
+ * @note This is an internal constant. Do not use directly in application code.
+ */
+inline constexpr std::size_t __median_network_max_size{25};
+
+/**
+ * @struct __MedianNetwork, A compile-time generated median selection network.
+ *
+ * Built from Batcher's odd-even merge sorting network for the next power of
+ * two, truncated to SizeV inputs. Walking the network backwards from the
+ * middle output keeps only the compare-exchanges that can move a value into
+ * it, which leaves a selection network close to the best known sizes
+ * (e.g., 8 compare-exchanges for 5 inputs and 24 for 9, against 7 and 19).
+ * The common sizes 3, 5, 7, 9 and 25 are specialized with the best known
+ * networks instead.
+ *
+ * @tparam SizeV    Number of inputs.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <std::size_t SizeV>
+struct __MedianNetwork {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    /**
+     * @brief Visit the compare-exchanges of the truncated sorting network in order.
+     *
+     * @param visit     Callable invoked with the lower and upper index of each pair.
+     */
+    static constexpr void ForEachSortPair(auto&& visit) noexcept
+    {
+        const std::size_t width{std::bit_ceil(SizeV)};
+        for (std::size_t p{1}; p < width; p *= 2) {
+            for (std::size_t k{p}; k >= 1; k /= 2) {
+                for (std::size_t j{k % p}; j + k < width; j += 2 * k) {
+                    for (std::size_t i{}; i < k; ++i) {
+                        const std::size_t lower{i + j};
+                        const std::size_t upper{i + j + k};
+                        if (upper < SizeV && lower / (2 * p) == upper / (2 * p)) {
+                            visit(lower, upper);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @returns Compare-exchanges of the truncated sorting network, zero padded.
+     */
+    static constexpr auto SortPairs() noexcept
+    {
+        constexpr std::size_t capacity{SizeV * SizeV};
+        std::array<PairT, capacity> pairs{};
+        std::size_t count{};
+        ForEachSortPair([&](std::size_t lower, std::size_t upper){
+            pairs[count++] = {lower, upper};
+        });
+        return std::pair{pairs, count};
+    }
+
+    /**
+     * @brief Mark the compare-exchanges that can affect the middle output.
+     *
+     * @returns Usage flags indexed like SortPairs() and the number of used pairs.
+     */
+    static constexpr auto UsedPairs() noexcept
+    {
+        const auto [pairs, count] = SortPairs();
+        std::array<bool, SizeV> relevant{};
+        relevant[SizeV / 2] = true;
+        std::array<bool, SizeV * SizeV> used{};
+        std::size_t used_count{};
+        for (std::size_t index{count}; index-- > 0;) {
+            const auto [lower, upper] = pairs[index];
+            if (relevant[lower] || relevant[upper]) {
+                relevant[lower] = true;
+                relevant[upper] = true;
+                used[index] = true;
+                ++used_count;
+            }
+        }
+        return std::pair{used, used_count};
+    }
+
+    /**
+     * @returns Compare-exchanges of the median network in execution order.
+     */
+    static constexpr auto Generate() noexcept
+    {
+        constexpr auto sort_pairs = SortPairs();
+        constexpr auto used_pairs = UsedPairs();
+        std::array<PairT, used_pairs.second> network{};
+        std::size_t count{};
+        for (std::size_t index{}; index < sort_pairs.second; ++index) {
+            if (used_pairs.first[index]) {
+                network[count++] = sort_pairs.first[index];
+            }
+        }
+        return network;
+    }
+
+    static constexpr auto pairs = Generate();
+};
+
+/**
+ * @brief Best known median networks, the first index of a pair receives the smaller value.
+ *
+ * The 3, 5, 7, 9 and 25 input networks take 3, 7, 13, 19 and 99
+ * compare-exchanges (N. Devillard, "Fast median search: an ANSI C
+ * implementation", 1998). They are verified against all 0-1 inputs, which
+ * proves them for any input by the 0-1 principle.
+ *
+ * @note These are internal specializations. Do not use directly in application code.
+ * @{
+ */
+template <>
+struct __MedianNetwork<3> {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    static constexpr std::array<PairT, 3> pairs{{
+        {0, 1}, {1, 2}, {0, 1}
+    }};
+};
+
+template <>
+struct __MedianNetwork<5> {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    static constexpr std::array<PairT, 7> pairs{{
+        {0, 1}, {3, 4}, {0, 3}, {1, 4}, {1, 2}, {2, 3}, {1, 2}
+    }};
+};
+
+template <>
+struct __MedianNetwork<7> {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    static constexpr std::array<PairT, 13> pairs{{
+        {0, 5}, {0, 3}, {1, 6}, {2, 4}, {0, 1}, {3, 5}, {2, 6}, {2, 3},
+        {3, 6}, {4, 5}, {1, 4}, {1, 3}, {3, 4}
+    }};
+};
+
+template <>
+struct __MedianNetwork<9> {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    static constexpr std::array<PairT, 19> pairs{{
+        {1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7}, {1, 2}, {4, 5},
+        {7, 8}, {0, 3}, {5, 8}, {4, 7}, {3, 6}, {1, 4}, {2, 5}, {4, 7},
+        {4, 2}, {6, 4}, {4, 2}
+    }};
+};
+
+template <>
+struct __MedianNetwork<25> {
+    using PairT = std::pair<std::size_t, std::size_t>;
+
+    static constexpr std::array<PairT, 99> pairs{{
+        {0, 1}, {3, 4}, {2, 4}, {2, 3}, {6, 7}, {5, 7}, {5, 6}, {9, 10},
+        {8, 10}, {8, 9}, {12, 13}, {11, 13}, {11, 12}, {15, 16}, {14, 16}, {14, 15},
+        {18, 19}, {17, 19}, {17, 18}, {21, 22}, {20, 22}, {20, 21}, {23, 24}, {2, 5},
+        {3, 6}, {0, 6}, {0, 3}, {4, 7}, {1, 7}, {1, 4}, {11, 14}, {8, 14},
+        {8, 11}, {12, 15}, {9, 15}, {9, 12}, {13, 16}, {10, 16}, {10, 13}, {20, 23},
+        {17, 23}, {17, 20}, {21, 24}, {18, 24}, {18, 21}, {19, 22}, {8, 17}, {9, 18},
+        {0, 18}, {0, 9}, {10, 19}, {1, 19}, {1, 10}, {11, 20}, {2, 20}, {2, 11},
+        {12, 21}, {3, 21}, {3, 12}, {13, 22}, {4, 22}, {4, 13}, {14, 23}, {5, 23},
+        {5, 14}, {15, 24}, {6, 24}, {6, 15}, {7, 16}, {7, 19}, {13, 21}, {15, 23},
+        {7, 13}, {7, 15}, {1, 9}, {3, 11}, {5, 17}, {11, 17}, {9, 17}, {4, 10},
+        {6, 12}, {7, 14}, {4, 6}, {4, 7}, {12, 14}, {10, 14}, {6, 7}, {10, 12},
+        {6, 10}, {6, 17}, {12, 17}, {7, 17}, {7, 10}, {12, 18}, {7, 12}, {10, 18},
+        {12, 20}, {10, 20}, {10, 12}
+    }};
+};
+/** @} */
+
+/**
+ * @brief Compare-exchange two elements with min/max, without data dependent branches.
+ *
+ * @param lower     Element receiving the smaller value.
+ * @param upper     Element receiving the larger value.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+template <typename T>
+constexpr void __CompareExchange(T& lower, T& upper) noexcept
+{
+    const T a{lower};
+    const T b{upper};
+    lower = std::min(a, b);
+    upper = std::max(a, b);
+}
+
+/**
+ * @brief Select the median of the first filled_size elements.
+ *
+ * Unfilled elements are padded so that the median of all SizeV elements is
+ * the upper median of the filled ones: (SizeV - filled_size) / 2 lowest
+ * values and the rest highest values. Sizes up to __median_network_max_size
+ * run the fixed median network, without a runtime sort.
+ *
+ * @param values        Samples, reordered in place.
+ * @param filled_size   Number of valid samples (1 to SizeV).
+ *
+ * @returns Element filled_size / 2 of the sorted valid samples.
+ *
+ * @note This is an internal function. Do not use directly in application code.
+ */
+template <typename T, std::size_t SizeV>
+[[nodiscard]]
+constexpr T __Median(std::array<T, SizeV>& values, std::size_t filled_size) noexcept
+{
+    if constexpr (SizeV <= __median_network_max_size) {
+        const std::size_t low_padding{(SizeV - filled_size) / 2};
+        for (std::size_t i{filled_size}; i < SizeV; ++i) {
+            values[i] = (i - filled_size < low_padding) ?
+                std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+        }
+        [&]<std::size_t... I>(std::index_sequence<I...>){
+            (__CompareExchange(
+                values[__MedianNetwork<SizeV>::pairs[I].first],
+                values[__MedianNetwork<SizeV>::pairs[I].second]
+            ), ...);
+        }(std::make_index_sequence<__MedianNetwork<SizeV>::pairs.size()>{});
+        return values[SizeV / 2];
+    } else {
+        const auto middle = values.begin() + filled_size / 2;
+        std::ranges::nth_element(values.begin(), middle, values.begin() + filled_size);
+        return *middle;
+    }
+}
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_MEDIAN_HPP */
@@ -0,0 +1,23 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_SIMD_HPP
+#define STM32_SIMD_HPP
+
+/**
+ * @def STM32_SIMD32
+ *
+ * @brief 1 if the core has the 32-bit SIMD (DSP) instructions (e.g., Cortex-M4, M7, M33), 0 otherwise.
+ *
+ * Derived from the ACLE feature macro. When 1, <arm_acle.h> is included and
+ * kernels may use the packed 16-bit intrinsics (e.g., __smlad, __usub16,
+ * __sel); otherwise they use their portable scalar path (e.g., Cortex-M0, host).
+ */
+#if defined(__ARM_FEATURE_SIMD32) && (__ARM_FEATURE_SIMD32 == 1)
+#include <arm_acle.h>
+#define STM32_SIMD32 1
+#else /* __ARM_FEATURE_SIMD32 */
+#define STM32_SIMD32 0
+#endif /* __ARM_FEATURE_SIMD32 */
+
+#endif /* STM32_SIMD_HPP */
@@ -0,0 +1,137 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_SPSC_RING_HPP
+#define STM32_SPSC_RING_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+
+namespace STM32::__Internal {
+
+/**
+ * @class __SpscRing, A lock-free single-producer single-consumer ring buffer.
+ * 
+ * Designed to pass items from an interrupt (producer) to the main loop
+ * (consumer) without masking interrupts. Indices run freely and are masked on
+ * access, so all CapacityV slots are usable.
+ * 
+ * @tparam T            Item type (copy-assignable).
+ * @tparam CapacityV    Number of slots (a power of two).
+ * 
+ * @note This is an internal class. Do not use directly in application code.
+ * @note Push() (or Reserve() and Commit()) must be called from one context
+ *       only, Pop() from one context only.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * __Internal::__SpscRing<Sample, 16> ring{};
+ * ring.Push(sample);          // In interrupt
+ * if (auto* slot = ring.Reserve()) {
+ *     slot->value = 42;       // Fill in place, in interrupt
+ *     ring.Commit();
+ * }
+ * Sample out{};
+ * while (ring.Pop(out)) { }   // In main loop
+ * @endcode
+ */
+template <typename T, std::size_t CapacityV>
+class __SpscRing {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Ring capacity must be a power of two"
+    );
+    static constexpr std::size_t mask{CapacityV - 1};
+public:
+
+    /**
+     * @brief Append an item.
+     * 
+     * @param item      Item to copy into the ring.
+     * 
+     * @returns True on success, false if the ring is full.
+     */
+    bool Push(const T& item) noexcept
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == CapacityV) {
+            return false;
+        }
+        m_items[head & mask] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the next free slot to fill in place, without publishing it.
+     * 
+     * Avoids building large items on the stack before Push(). The slot holds
+     * stale data and becomes visible to Pop() on Commit().
+     * 
+     * @returns Pointer to the free slot, nullptr if the ring is full.
+     */
+    [[nodiscard]]
+    T* Reserve() noexcept
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == CapacityV) {
+            return nullptr;
+        }
+        return &m_items[head & mask];
+    }
+
+    /**
+     * @brief Publish the slot returned by the last successful Reserve().
+     */
+    void Commit() noexcept
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Remove the oldest item.
+     * 
+     * @param item      Reference to store the item.
+     * 
+     * @returns True on success, false if the ring is empty.
+     */
+    bool Pop(T& item) noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (m_head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        item = m_items[tail & mask];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @returns Number of items in the ring.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns Number of slots.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityV;
+    }
+
+private:
+    std::array<T, CapacityV> m_items{};
+    std::atomic<std::size_t> m_head{0};
+    std::atomic<std::size_t> m_tail{0};
+};
+
+} /* namespace STM32::__Internal */
+
+#endif /* STM32_SPSC_RING_HPP */
@@ -11,9 +11,18 @@
  * This header provides a convenient single include for all internal utilities:
  * - __CallbackManager: Self-registering RAII callback manager for HAL peripherals.
  * - __Constant: Compile-time constant value wrapper.
+ * - __CriticalSection: RAII interrupt masking guard.
+ * - __DCache: Data cache maintenance for DMA buffers on Cortex-M7 cores.
+ * - __FixedPoint: Exact rational scaling with integer multiply and shift.
  * - __InplaceFunction: Non-allocating callable wrapper for embedded systems.
+ * - __LookupTable: Compile-time piecewise-linear tables with integer interpolation.
+ * - __Math: Constexpr rounding, integer square root and turn-based sine and cosine.
+ * - __Median: Compile-time generated median selection networks.
  * - __Message: Message buffer concept and size clamping utility.
  * - __Range: Compile-time numeric range definition.
+ * - __Reflect: Bit reversal helpers for CRC calculations.
+ * - __Simd: Detection of the Cortex-M 32-bit SIMD (DSP) instructions.
+ * - __SpscRing: Lock-free single-producer single-consumer ring buffer.
  * - __UniqueTag: Unique type generation for template differentiation.
  * 
  * @note These are internal utilities. Application code should not include
@@ -22,9 +31,18 @@
 
 #include "__CallbackManager.hpp"
 #include "__Constant.hpp"
+#include "__CriticalSection.hpp"
+#include "__DCache.hpp"
+#include "__FixedPoint.hpp"
 #include "__InplaceFunction.hpp"
+#include "__LookupTable.hpp"
+#include "__Math.hpp"
+#include "__Median.hpp"
 #include "__Message.hpp"
 #include "__Range.hpp"
+#include "__Reflect.hpp"
+#include "__Simd.hpp"
+#include "__SpscRing.hpp"
 #include "__UniqueTag.hpp"
 
 #endif /* STM32_UTILITY_HPP */
@@ -0,0 +1,90 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file arm_acle.h, Host emulation of the ACLE 32-bit SIMD intrinsics used by the library.
+ *
+ * Tests built with __ARM_FEATURE_SIMD32=1 include this header instead of the
+ * compiler's, so the SIMD paths run on the host and can be compared with the
+ * scalar paths. Each intrinsic follows the Arm architecture pseudocode,
+ * including the wrap-around of 32-bit results. The APSR.GE flags written by
+ * __usub16 and read by __sel are a global, as on a single core.
+ */
+
+#ifndef STM32_TESTS_ARM_ACLE_H
+#define STM32_TESTS_ARM_ACLE_H
+
+#include <cstdint>
+
+inline std::uint32_t fake_apsr_ge{};
+
+/**
+ * @brief Signed halfwords of a packed pair and the 32-bit wrap-around of a result.
+ * @{
+ */
+inline std::int32_t FakeLow(std::int32_t value) { return static_cast<std::int16_t>(value & 0xFFFF); }
+inline std::int32_t FakeHigh(std::int32_t value) { return static_cast<std::int16_t>(static_cast<std::uint32_t>(value) >> 16); }
+inline std::int32_t FakeWrap(std::int64_t value) { return static_cast<std::int32_t>(static_cast<std::uint32_t>(value)); }
+/** @} */
+
+/**
+ * @returns accumulator + low(a) * low(b) + high(a) * high(b), wrapping at 32 bits.
+ */
+inline std::int32_t __smlad(std::int32_t a, std::int32_t b, std::int32_t accumulator)
+{
+    return FakeWrap(std::int64_t{accumulator} + FakeLow(a) * FakeLow(b) + FakeHigh(a) * FakeHigh(b));
+}
+
+/**
+ * @returns accumulator + low(a) * low(b) + high(a) * high(b) in 64 bits.
+ */
+inline std::int64_t __smlald(std::int32_t a, std::int32_t b, std::int64_t accumulator)
+{
+    return static_cast<std::int64_t>(
+        static_cast<std::uint64_t>(accumulator) +
+        static_cast<std::uint64_t>(std::int64_t{FakeLow(a) * FakeLow(b)} + FakeHigh(a) * FakeHigh(b))
+    );
+}
+
+/**
+ * @returns low(a) * low(b) - high(a) * high(b), wrapping at 32 bits.
+ */
+inline std::int32_t __smusd(std::int32_t a, std::int32_t b)
+{
+    return FakeWrap(std::int64_t{FakeLow(a) * FakeLow(b)} - FakeHigh(a) * FakeHigh(b));
+}
+
+/**
+ * @returns low(a) * high(b) + high(a) * low(b), wrapping at 32 bits.
+ */
+inline std::int32_t __smuadx(std::int32_t a, std::int32_t b)
+{
+    return FakeWrap(std::int64_t{FakeLow(a) * FakeHigh(b)} + FakeHigh(a) * FakeLow(b));
+}
+
+/**
+ * @returns Unsigned halfword differences a - b, setting GE[1:0] and GE[3:2]
+ *          where the halfword of a is not below the one of b.
+ */
+inline std::uint32_t __usub16(std::uint32_t a, std::uint32_t b)
+{
+    const std::uint32_t low{(a & 0xFFFF) - (b & 0xFFFF)};
+    const std::uint32_t high{(a >> 16) - (b >> 16)};
+    fake_apsr_ge = ((a & 0xFFFF) >= (b & 0xFFFF) ? 0x3U : 0) | ((a >> 16) >= (b >> 16) ? 0xCU : 0);
+    return (high << 16) | (low & 0xFFFF);
+}
+
+/**
+ * @returns Each byte from a where its GE flag is set, from b otherwise.
+ */
+inline std::uint32_t __sel(std::uint32_t a, std::uint32_t b)
+{
+    std::uint32_t result{};
+    for (std::uint32_t byte{}; byte < 4; ++byte) {
+        const std::uint32_t mask{0xFFU << (8 * byte)};
+        result |= (((fake_apsr_ge >> byte) & 1) ? a : b) & mask;
+    }
+    return result;
+}
+
+#endif /* STM32_TESTS_ARM_ACLE_H */
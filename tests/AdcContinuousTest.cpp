@@ -0,0 +1,79 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file AdcContinuousTest.cpp, Host simulation of AdcContinuous on the fake ADC.
+ *
+ * The fake has no hardware oversampler, so oversampled instances take the
+ * software path. The tests check the DMA window, the masked transfer
+ * interrupts and the decimated result.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <STM32LibraryCollection/Adc.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+DMA_HandleTypeDef hdma{};
+ADC_HandleTypeDef hadc{};
+
+void Reset()
+{
+    hadc.DMA_Handle = &hdma;
+    hadc.FakeRunning = false;
+    hadc.FakeStartStatus = HAL_OK;
+    hadc.FakeStartCount = 0;
+    hdma.FakeInterrupts = 0;
+}
+
+void TestSoftwareOversamplingMasksTransferInterrupts()
+{
+    Reset();
+    STM32::AdcContinuous<STM32::AdcOversampling<2>> adc{hadc};
+    STM32_CHECK(adc.Start());
+    STM32_CHECK(hadc.FakeLength == 16);
+    STM32_CHECK(hdma.FakeInterrupts == DMA_IT_TE);
+
+    /* 4^2 conversions of 1000 to 1015 sum to 16120, 14-bit result is 16120 >> 2 */
+    for (std::uint32_t i = 0; i < hadc.FakeLength; ++i) {
+        hadc.FakeBuffer[i] = static_cast<std::uint16_t>(1000 + i);
+    }
+    STM32_CHECK(adc.GetRaw() == 4030);
+
+    STM32_CHECK(adc.Stop());
+    STM32_CHECK(!hadc.FakeRunning);
+}
+
+void TestFailedStartLeavesInterruptsAlone()
+{
+    Reset();
+    hadc.FakeStartStatus = HAL_ERROR;
+    STM32::AdcContinuous<STM32::AdcOversampling<1>> adc{hadc};
+    STM32_CHECK(!adc.Start());
+    STM32_CHECK(hdma.FakeInterrupts == 0);
+}
+
+void TestWithoutOversamplingReadsDataRegister()
+{
+    Reset();
+    STM32::AdcContinuous<> adc{hadc};
+    STM32_CHECK(adc.Start());
+    hadc.FakeValue = 2048;
+    STM32_CHECK(adc.GetRaw() == 2048);
+    STM32_CHECK(hadc.FakeStartCount == 0);
+}
+
+} /* namespace */
+
+int main()
+{
+    TestSoftwareOversamplingMasksTransferInterrupts();
+    TestFailedStartLeavesInterruptsAlone();
+    TestWithoutOversamplingReadsDataRegister();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file AdcScanTest.cpp, Host simulation of AdcScan on the fake ADC.
+ *
+ * Half buffers are filled by hand, as the circular DMA would, and the tests
+ * check the de-interleaved blocks, the latest values, dropped blocks and the
+ * DMA restart after an overrun.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <STM32LibraryCollection/Adc.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+constexpr std::size_t channel_count{3};
+constexpr std::size_t block_size{4};
+constexpr std::size_t half_size{channel_count * block_size};
+
+ADC_HandleTypeDef hadc{};
+
+using Scan = STM32::AdcScan<
+    STM32_UNIQUE_TAG, STM32::AdcScanChannelCount<channel_count>, STM32::AdcScanBlockSize<block_size>
+>;
+
+void Reset()
+{
+    hadc.FakeRunning = false;
+    hadc.FakeStartStatus = HAL_OK;
+    hadc.FakeStartCount = 0;
+}
+
+/**
+ * @returns A half buffer in conversion order, sample s of channel c is 100 * c + s + offset.
+ */
+std::array<std::uint16_t, half_size> Conversions(std::uint16_t offset)
+{
+    std::array<std::uint16_t, half_size> samples{};
+    for (std::size_t sample = 0; sample < block_size; ++sample) {
+        for (std::size_t channel = 0; channel < channel_count; ++channel) {
+            samples[sample * channel_count + channel] =
+                static_cast<std::uint16_t>(100 * channel + sample + offset);
+        }
+    }
+    return samples;
+}
+
+void TestDeinterleavesEachHalf()
+{
+    Reset();
+    Scan scan{hadc};
+    int calls{};
+    STM32_CHECK(scan.Start([&](){
+        ++calls;
+    }));
+    STM32_CHECK(hadc.FakeLength == 2 * half_size);
+
+    for (std::uint16_t half = 0; half < 4; ++half) {
+        const auto conversions = Conversions(static_cast<std::uint16_t>(10 * half));
+        FakeAdcFillHalf(&hadc, half % 2, conversions.data());
+        const auto* block = scan.GetReadyBlock();
+        STM32_CHECK(block != nullptr);
+        if (block == nullptr) {
+            continue;
+        }
+        for (std::size_t channel = 0; channel < channel_count; ++channel) {
+            for (std::size_t sample = 0; sample < block_size; ++sample) {
+                STM32_CHECK(block->Channel(channel)[sample] == 100 * channel + sample + 10 * half);
+            }
+            STM32_CHECK(scan.GetLatest(channel) == 100 * channel + block_size - 1 + 10 * half);
+        }
+        STM32_CHECK(scan.GetInterleaved()[1] == conversions[1]);
+        scan.ReleaseBlock();
+    }
+    STM32_CHECK(calls == 4);
+    STM32_CHECK(scan.GetDroppedBlockCount() == 0);
+}
+
+void TestKeepsReadyBlockUntilReleased()
+{
+    Reset();
+    Scan scan{hadc};
+    int calls{};
+    STM32_CHECK(scan.Start([&](){
+        ++calls;
+    }));
+
+    const auto first = Conversions(0);
+    const auto second = Conversions(50);
+    FakeAdcFillHalf(&hadc, 0, first.data());
+    FakeAdcFillHalf(&hadc, 1, second.data());
+
+    /* The second half is dropped, the ready block and the latest values differ */
+    const auto* block = scan.GetReadyBlock();
+    STM32_CHECK(block != nullptr && block->Channel(2)[0] == 200);
+    STM32_CHECK(scan.GetLatest(2) == 200 + block_size - 1 + 50);
+    STM32_CHECK(scan.GetDroppedBlockCount() == 1);
+    STM32_CHECK(calls == 1);
+}
+
+void TestRestartsAfterOverrun()
+{
+    Reset();
+    Scan scan{hadc};
+    STM32_CHECK(scan.Start());
+    STM32_CHECK(scan.IsRunning());
+
+    FakeAdcFail(&hadc);
+    STM32_CHECK(scan.GetErrorCount() == 1);
+    STM32_CHECK(hadc.FakeStartCount == 2);
+    STM32_CHECK(hadc.FakeRunning);
+    STM32_CHECK(scan.IsRunning());
+
+    const auto conversions = Conversions(0);
+    FakeAdcFillHalf(&hadc, 0, conversions.data());
+    STM32_CHECK(scan.GetReadyBlock() != nullptr);
+
+    /* A refused restart leaves the scan stalled and visible */
+    hadc.FakeStartStatus = HAL_ERROR;
+    FakeAdcFail(&hadc);
+    STM32_CHECK(scan.GetErrorCount() == 2);
+    STM32_CHECK(!scan.IsRunning());
+
+    /* Errors after Stop() do not restart conversions */
+    hadc.FakeStartStatus = HAL_OK;
+    STM32_CHECK(scan.Start());
+    STM32_CHECK(scan.Stop());
+    FakeAdcFail(&hadc);
+    STM32_CHECK(!hadc.FakeRunning);
+    STM32_CHECK(!scan.IsRunning());
+}
+
+} /* namespace */
+
+int main()
+{
+    TestDeinterleavesEachHalf();
+    TestKeepsReadyBlockUntilReleased();
+    TestRestartsAfterOverrun();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,124 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file BlockStatisticsTest.cpp, Exact results of the scalar and SIMD block statistics.
+ *
+ * Built twice: BlockStatisticsTest takes the scalar path, BlockStatisticsTestSimd
+ * the packed SMLAD/SMLALD/USUB16/SEL path on the emulated intrinsics. Both are
+ * checked against the same direct sums, so the two paths give identical
+ * results for odd sizes, unaligned blocks, blocks longer than one SIMD chunk
+ * and full-scale samples.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <STM32LibraryCollection/BlockStatistics.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+std::mt19937 generator{42};
+
+std::vector<std::uint16_t> RandomSamples(std::size_t count, std::uint32_t bits)
+{
+    std::uniform_int_distribution<std::uint32_t> sample{0, (std::uint32_t{1} << bits) - 1};
+    std::vector<std::uint16_t> samples(count);
+    for (auto& value : samples) {
+        value = static_cast<std::uint16_t>(sample(generator));
+    }
+    return samples;
+}
+
+/**
+ * @brief Check accumulated statistics against direct sums of the same samples.
+ */
+template <typename StatisticsT>
+void CheckMatches(const StatisticsT& statistics, std::span<const std::uint16_t> samples)
+{
+    std::uint64_t sum{};
+    std::uint64_t sum_of_squares{};
+    for (const std::uint64_t sample : samples) {
+        sum += sample;
+        sum_of_squares += sample * sample;
+    }
+    STM32_CHECK(statistics.GetCount() == samples.size());
+    STM32_CHECK(statistics.GetSum() == sum);
+    STM32_CHECK(statistics.GetSumOfSquares() == sum_of_squares);
+    if (samples.empty()) {
+        STM32_CHECK(statistics.GetMin() == 0 && statistics.GetMax() == 0);
+        STM32_CHECK(statistics.GetMean() == 0 && statistics.GetRms() == 0);
+        return;
+    }
+    STM32_CHECK(statistics.GetMin() == std::ranges::min(samples));
+    STM32_CHECK(statistics.GetMax() == std::ranges::max(samples));
+    STM32_CHECK(statistics.GetMean() == (sum + samples.size() / 2) / samples.size());
+    const std::uint64_t mean_square{sum_of_squares / samples.size()};
+    const std::uint64_t rms{statistics.GetRms()};
+    STM32_CHECK(rms * rms <= mean_square && mean_square < (rms + 1) * (rms + 1));
+}
+
+template <std::uint32_t BitsV>
+void TestBlockSizes()
+{
+    const auto samples = RandomSamples(1031, BitsV);
+    /* Every size from 0 to 9 at both alignments, then odd and even larger ones */
+    for (std::size_t offset{}; offset < 2; ++offset) {
+        for (std::size_t size : {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 255, 256, 1029}) {
+            STM32::BlockStatistics<STM32::BlockStatisticsSampleBits<BitsV>> statistics{};
+            const std::span<const std::uint16_t> block{samples.data() + offset, size};
+            statistics.Update(block);
+            CheckMatches(statistics, block);
+        }
+    }
+}
+
+template <std::uint32_t BitsV>
+void TestAccumulatesBlocks()
+{
+    const auto samples = RandomSamples(3000, BitsV);
+    STM32::BlockStatistics<STM32::BlockStatisticsSampleBits<BitsV>> statistics{};
+    std::size_t position{};
+    for (std::size_t size : {1, 7, 256, 3, 1000, 2, 731}) {
+        statistics.Update(std::span<const std::uint16_t>{samples.data() + position, size});
+        position += size;
+    }
+    CheckMatches(statistics, std::span<const std::uint16_t>{samples.data(), position});
+    statistics.Reset();
+    CheckMatches(statistics, std::span<const std::uint16_t>{});
+}
+
+/**
+ * Full-scale 15-bit samples over more than two SIMD chunks are the largest
+ * sums the packed 32-bit accumulator has to hold before it is flushed.
+ */
+void TestFullScaleLongBlock()
+{
+    std::vector<std::uint16_t> samples(70'001, 0x7FFF);
+    samples[12'345] = 0;
+    samples[65'540] = 1;
+    STM32::BlockStatistics<STM32::BlockStatisticsSampleBits<15>> statistics{};
+    statistics.Update(samples);
+    CheckMatches(statistics, samples);
+}
+
+} /* namespace */
+
+int main()
+{
+    std::printf("BlockStatistics path: %s\n", STM32_SIMD32 ? "SIMD (emulated)" : "scalar");
+    TestBlockSizes<12>();
+    TestBlockSizes<15>();
+    TestBlockSizes<16>();
+    TestAccumulatesBlocks<12>();
+    TestAccumulatesBlocks<15>();
+    TestFullScaleLongBlock();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,75 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_TESTS_CHECK_HPP
+#define STM32_TESTS_CHECK_HPP
+
+#include <chrono>
+#include <cstdio>
+
+namespace STM32::Test {
+
+inline int failure_count{};
+
+/**
+ * @brief Record the outcome of a check, printing the failed ones.
+ */
+inline bool Check(bool passed, const char* expression, const char* file, int line) noexcept
+{
+    if (!passed) {
+        std::printf("%s:%d: check failed: %s\n", file, line, expression);
+        ++failure_count;
+    }
+    return passed;
+}
+
+/**
+ * @returns Process exit status, non-zero if any check failed.
+ */
+inline int Result() noexcept
+{
+    if (failure_count != 0) {
+        std::printf("%d check(s) failed\n", failure_count);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Run a callable repeatedly and report the achieved rate.
+ *
+ * @param name          Label printed with the result.
+ * @param items         Items (e.g., samples) processed by one call.
+ * @param iterations    Number of calls.
+ * @param function      Callable to measure.
+ *
+ * @returns Items processed per second.
+ */
+template <typename FunctionT>
+double Benchmark(const char* name, double items, long iterations, FunctionT&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+        function();
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    const double rate{items * static_cast<double>(iterations) / elapsed.count()};
+    std::printf("%-32s %12.3e items/s\n", name, rate);
+    return rate;
+}
+
+/**
+ * @brief Keep a value alive so the optimizer cannot drop its computation.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) noexcept
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+} /* namespace STM32::Test */
+
+#define STM32_CHECK(expression) \
+    ::STM32::Test::Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif /* STM32_TESTS_CHECK_HPP */
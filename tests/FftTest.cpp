@@ -0,0 +1,234 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file FftTest.cpp, Accuracy and throughput of the fixed-point FFT and Goertzel detector.
+ *
+ * Fft spectra are compared bin by bin with a double DFT scaled by 1 / SizeT,
+ * Goertzel powers with the double DFT of the same block at the tone
+ * frequency. Built twice (see SIMD in CMakeLists.txt), the Q15 spectra of
+ * fixed inputs must also hash to the same value with and without the DSP
+ * multiplication, which makes the two paths bit-identical.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <STM32LibraryCollection/Fft.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+/* Raw generator output only, the distributions differ between standard libraries */
+std::mt19937 generator{42};
+
+std::uint16_t RandomSample(std::uint32_t bits)
+{
+    return static_cast<std::uint16_t>(generator() >> (32 - bits));
+}
+
+/**
+ * @returns Bin k of the DFT of x, scaled by 1 / size.
+ */
+std::complex<double> Dft(const std::vector<std::complex<double>>& x, std::size_t k)
+{
+    const std::size_t size{x.size()};
+    std::complex<double> sum{};
+    for (std::size_t n{}; n < size; ++n) {
+        const double turn{static_cast<double>((k * n) % size) / static_cast<double>(size)};
+        sum += x[n] * std::polar(1., -2. * std::numbers::pi * turn);
+    }
+    return sum / static_cast<double>(size);
+}
+
+/**
+ * @returns Largest bin error against the double DFT in LSB of SampleT.
+ */
+template <typename FftT, std::size_t SizeV>
+double MaxError(
+    const std::vector<std::complex<double>>& input,
+    const std::array<typename FftT::ComplexT, SizeV>& spectrum
+)
+{
+    double error{};
+    for (std::size_t k{}; k < SizeV; ++k) {
+        const std::complex<double> bin{
+            static_cast<double>(spectrum[k].re), static_cast<double>(spectrum[k].im)
+        };
+        error = std::max(error, std::abs(Dft(input, k) - bin));
+    }
+    return error;
+}
+
+/**
+ * Random blocks and pure tones, both far from saturation. Each stage rounds
+ * once, so the error stays within a couple of LSB for every size.
+ */
+template <typename SampleT, std::size_t SizeV, std::uint32_t BitsV = 12>
+void TestTransformMatchesDft()
+{
+    using FftT = STM32::Fft<SampleT, STM32::FftSize<SizeV>, STM32::FftSampleBits<BitsV>>;
+    const double scale{std::ldexp(1., std::numeric_limits<SampleT>::digits + 1 - BitsV)};
+    const double middle{static_cast<double>(1U << (BitsV - 1))};
+    for (int round{}; round < 4; ++round) {
+        std::array<std::uint16_t, SizeV> samples{};
+        const std::size_t tone{generator() % (SizeV / 2)};
+        for (std::size_t n{}; n < SizeV; ++n) {
+            const double phase{2. * std::numbers::pi * static_cast<double>(tone * n) / SizeV + 0.3};
+            samples[n] = (round % 2 == 0) ?
+                RandomSample(BitsV) :
+                static_cast<std::uint16_t>(std::lround(middle + (middle - 1) * std::cos(phase)));
+        }
+        std::vector<std::complex<double>> input(SizeV);
+        for (std::size_t n{}; n < SizeV; ++n) {
+            input[n] = (samples[n] - middle) * scale;
+        }
+        std::array<typename FftT::ComplexT, SizeV> spectrum{};
+        FftT::Transform(samples, spectrum);
+        STM32_CHECK(MaxError<FftT>(input, spectrum) < 2.);
+    }
+}
+
+template <typename SampleT, std::size_t SizeV>
+void TestComplexTransformMatchesDft()
+{
+    using FftT = STM32::Fft<SampleT, STM32::FftSize<SizeV>>;
+    /* Parts within half of full scale keep every magnitude below 1 */
+    constexpr std::uint32_t bits{std::numeric_limits<SampleT>::digits};
+    std::array<typename FftT::ComplexT, SizeV> data{};
+    std::vector<std::complex<double>> input(SizeV);
+    for (std::size_t n{}; n < SizeV; ++n) {
+        const auto re = static_cast<SampleT>(static_cast<std::int64_t>(generator() >> (32 - bits)) - (std::int64_t{1} << (bits - 1)));
+        const auto im = static_cast<SampleT>(static_cast<std::int64_t>(generator() >> (32 - bits)) - (std::int64_t{1} << (bits - 1)));
+        data[n] = {re, im};
+        input[n] = {static_cast<double>(re), static_cast<double>(im)};
+    }
+    FftT::Transform(data);
+    STM32_CHECK(MaxError<FftT>(input, data) < 2.);
+}
+
+/**
+ * @returns FNV-1a hash of the Q15 spectra of fixed blocks of every size.
+ */
+std::uint32_t HashQ15Spectra()
+{
+    std::uint32_t hash{2166136261U};
+    const auto add = [&hash](auto spectrum){
+        for (const auto& bin : spectrum) {
+            for (const std::int16_t part : {bin.re, bin.im}) {
+                hash = (hash ^ static_cast<std::uint16_t>(part)) * 16777619U;
+            }
+        }
+    };
+    std::mt19937 fixed{7};
+    [&]<std::size_t... I>(std::index_sequence<I...>){
+        ([&](){
+            constexpr std::size_t size{std::size_t{16} << I};
+            std::array<std::uint16_t, size> samples{};
+            for (auto& sample : samples) {
+                sample = static_cast<std::uint16_t>(fixed() >> 20);
+            }
+            std::array<STM32::FftComplex<std::int16_t>, size> spectrum{};
+            STM32::Fft<std::int16_t, STM32::FftSize<size>>::Transform(samples, spectrum);
+            add(spectrum);
+        }(), ...);
+    }(std::make_index_sequence<9>{});
+    return hash;
+}
+
+/**
+ * The power is checked against the double DFT of the last completed block,
+ * relative to the power of a full-scale tone, and the amplitude to one code.
+ */
+template <std::uint32_t FrequencyV, std::uint32_t RateV, std::uint32_t SizeV>
+void TestGoertzelMatchesDft(double tone, double amplitude)
+{
+    STM32::Goertzel<
+        STM32::GoertzelFrequency<FrequencyV>, STM32::GoertzelSampleRate<RateV>, STM32::GoertzelBlockSize<SizeV>
+    > goertzel{};
+    std::vector<std::uint16_t> samples(2 * SizeV + SizeV / 2);
+    for (std::size_t n{}; n < samples.size(); ++n) {
+        const double phase{2. * std::numbers::pi * tone * static_cast<double>(n) / RateV};
+        samples[n] = static_cast<std::uint16_t>(std::lround(2048. + amplitude * std::sin(phase)));
+    }
+    STM32_CHECK(goertzel.Update(samples));
+
+    std::complex<double> sum{};
+    for (std::size_t n{SizeV}; n < 2 * SizeV; ++n) {
+        const double turn{static_cast<double>(FrequencyV) * static_cast<double>(n) / RateV};
+        sum += (samples[n] - 2048.) * std::polar(1., -2. * std::numbers::pi * turn);
+    }
+    const double full_scale{std::pow(2047. * SizeV / 2., 2)};
+    const double error{std::abs(static_cast<double>(goertzel.GetPower()) - std::norm(sum)) / full_scale};
+    STM32_CHECK(error < 1e-4);
+    const double expected_amplitude{2. * std::abs(sum) / SizeV};
+    STM32_CHECK(std::abs(goertzel.GetAmplitude() - expected_amplitude) <= 1.);
+}
+
+void Benchmark()
+{
+    constexpr std::size_t size{256};
+    std::array<std::uint16_t, size> samples{};
+    for (auto& sample : samples) {
+        sample = RandomSample(12);
+    }
+    std::array<STM32::FftComplex<std::int16_t>, size> q15{};
+    STM32::Test::Benchmark("fft q15 256", size, 20000, [&](){
+        STM32::Fft<std::int16_t, STM32::FftSize<size>>::Transform(samples, q15);
+        STM32::Test::DoNotOptimize(q15);
+    });
+    std::array<STM32::FftComplex<std::int32_t>, size> q31{};
+    STM32::Test::Benchmark("fft q31 256", size, 20000, [&](){
+        STM32::Fft<std::int32_t, STM32::FftSize<size>>::Transform(samples, q31);
+        STM32::Test::DoNotOptimize(q31);
+    });
+    STM32::Goertzel<
+        STM32::GoertzelFrequency<1000>, STM32::GoertzelSampleRate<48000>, STM32::GoertzelBlockSize<size>
+    > goertzel{};
+    STM32::Test::Benchmark("goertzel 1 tone", size, 20000, [&](){
+        STM32::Test::DoNotOptimize(goertzel.Update(samples));
+    });
+    std::vector<std::complex<double>> input(samples.begin(), samples.end());
+    STM32::Test::Benchmark("double dft 256", size, 20, [&](){
+        for (std::size_t k{}; k < size; ++k) {
+            STM32::Test::DoNotOptimize(Dft(input, k));
+        }
+    });
+}
+
+} /* namespace */
+
+int main()
+{
+    TestTransformMatchesDft<std::int16_t, 16>();
+    TestTransformMatchesDft<std::int16_t, 32>();
+    TestTransformMatchesDft<std::int16_t, 256>();
+    TestTransformMatchesDft<std::int16_t, 1024>();
+    TestTransformMatchesDft<std::int16_t, 64, 16>();
+    TestTransformMatchesDft<std::int32_t, 16>();
+    TestTransformMatchesDft<std::int32_t, 128>();
+    TestTransformMatchesDft<std::int32_t, 512>();
+    TestTransformMatchesDft<std::int32_t, 64, 16>();
+    TestComplexTransformMatchesDft<std::int16_t, 256>();
+    TestComplexTransformMatchesDft<std::int32_t, 128>();
+    STM32_CHECK(HashQ15Spectra() == 0x8D30'2314);
+
+    TestGoertzelMatchesDft<1000, 48000, 480>(1000., 1000.);
+    TestGoertzelMatchesDft<1000, 48000, 480>(1500., 1000.);
+    TestGoertzelMatchesDft<697, 8000, 205>(697., 500.);
+    TestGoertzelMatchesDft<697, 8000, 205>(770., 500.);
+    TestGoertzelMatchesDft<3, 48000, 65535>(3., 2047.);
+    Benchmark();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,223 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file FilterTest.cpp, Correctness and throughput of the streaming filters.
+ *
+ * Each filter is checked against a direct reference on random streams:
+ * MovingAverage against the window sum, Ema against the double recurrence,
+ * RunningMedian against std::ranges::nth_element of the window and
+ * CicDecimator against cascaded boxcar sums. The samples/s of each filter
+ * are reported for one 4096-sample block.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <STM32LibraryCollection/Filter.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+std::mt19937 generator{42};
+
+template <typename SampleT>
+std::vector<SampleT> RandomSamples(std::size_t count, int minimum, int maximum)
+{
+    std::uniform_int_distribution<int> sample{minimum, maximum};
+    std::vector<SampleT> samples(count);
+    for (auto& value : samples) {
+        value = static_cast<SampleT>(sample(generator));
+    }
+    return samples;
+}
+
+template <typename SampleT, std::size_t WindowV>
+void TestMovingAverage()
+{
+    STM32::MovingAverage<SampleT, STM32::FilterWindow<WindowV>> average{};
+    std::deque<SampleT> window{};
+    for (const auto sample : RandomSamples<SampleT>(4 * WindowV + 7, 0, 4095)) {
+        window.push_back(sample);
+        if (window.size() > WindowV) {
+            window.pop_front();
+        }
+        double sum{};
+        for (const auto value : window) {
+            sum += static_cast<double>(value);
+        }
+        const double expected{sum / static_cast<double>(window.size())};
+        const auto result = average.Update(sample);
+        if constexpr (std::floating_point<SampleT>) {
+            STM32_CHECK(std::abs(static_cast<double>(result) - expected) < 1e-3);
+        } else {
+            STM32_CHECK(result == static_cast<SampleT>(expected));
+        }
+        STM32_CHECK(average.IsFull() == (window.size() == WindowV));
+    }
+    average.Reset();
+    STM32_CHECK(average.Get() == SampleT{} && !average.IsFull());
+}
+
+/**
+ * A long stream of large values followed by small ones: the float running
+ * sum must not keep the rounding errors of the large phase.
+ */
+void TestMovingAverageDoesNotDrift()
+{
+    constexpr std::size_t window{32};
+    STM32::MovingAverage<float, STM32::FilterWindow<window>> average{};
+    std::uniform_real_distribution<float> large{0.f, 1e6f};
+    for (std::size_t index = 0; index < (std::size_t{1} << 20); ++index) {
+        average.Update(large(generator));
+    }
+    for (std::size_t index = 0; index < 2 * window; ++index) {
+        const auto result = average.Update(0.25f);
+        if (index + 1 >= window) {
+            STM32_CHECK(std::abs(result - 0.25f) < 1e-3f);
+        }
+    }
+}
+
+/**
+ * The fixed-point state carries the fraction bits, so the integer result
+ * stays within one count of the exact recurrence (truncated).
+ */
+template <std::uint32_t ShiftV>
+void TestEma()
+{
+    STM32::Ema<std::uint16_t, STM32::EmaShift<ShiftV>> ema{};
+    const auto samples = RandomSamples<std::uint16_t>(10000, 0, 4095);
+    double expected{static_cast<double>(samples.front())};
+    for (const auto sample : samples) {
+        expected += (sample - expected) / static_cast<double>(1U << ShiftV);
+        const auto result = ema.Update(sample);
+        STM32_CHECK(std::abs(static_cast<double>(result) - std::floor(expected)) <= 1.);
+    }
+
+    /* A constant input settles on that value, the first sample initializes the state */
+    ema.Reset();
+    STM32_CHECK(ema.Update(1000) == 1000);
+    for (int i{}; i < 64 << ShiftV; ++i) {
+        ema.Update(3000);
+    }
+    STM32_CHECK(ema.Get() == 3000);
+}
+
+template <typename SampleT, std::size_t WindowV>
+void TestRunningMedian()
+{
+    STM32::RunningMedian<SampleT, STM32::FilterWindow<WindowV>> median{};
+    std::deque<SampleT> window{};
+    /* A narrow range repeats values, which exercises ties in the heaps */
+    for (const auto sample : RandomSamples<SampleT>(8 * WindowV + 11, 0, 2 * static_cast<int>(WindowV))) {
+        window.push_back(sample);
+        if (window.size() > WindowV) {
+            window.pop_front();
+        }
+        std::vector<SampleT> sorted(window.begin(), window.end());
+        const auto middle = sorted.begin() + static_cast<std::ptrdiff_t>(sorted.size() / 2);
+        std::ranges::nth_element(sorted, middle);
+        STM32_CHECK(median.Update(sample) == *middle);
+    }
+}
+
+/**
+ * @returns Decimated outputs of StagesV cascaded RatioV-sample moving sums divided by the gain.
+ */
+template <typename SampleT, std::uint32_t RatioV, std::uint32_t StagesV>
+std::vector<SampleT> CicReference(const std::vector<SampleT>& samples)
+{
+    std::vector<std::int64_t> stage(samples.begin(), samples.end());
+    std::int64_t gain{1};
+    for (std::uint32_t s{}; s < StagesV; ++s) {
+        std::vector<std::int64_t> next(stage.size());
+        for (std::size_t n{}; n < stage.size(); ++n) {
+            for (std::size_t i{}; i < RatioV && i <= n; ++i) {
+                next[n] += stage[n - i];
+            }
+        }
+        stage = next;
+        gain *= RatioV;
+    }
+    std::vector<SampleT> outputs{};
+    for (std::size_t n{RatioV - 1}; n < stage.size(); n += RatioV) {
+        outputs.push_back(static_cast<SampleT>(stage[n] / gain));
+    }
+    return outputs;
+}
+
+template <typename SampleT, std::uint32_t RatioV, std::uint32_t StagesV>
+void TestCicDecimator(int minimum, int maximum)
+{
+    STM32::CicDecimator<SampleT, STM32::CicDecimation<RatioV>, STM32::CicStages<StagesV>> cic{};
+    const auto samples = RandomSamples<SampleT>(64 * RatioV + 3, minimum, maximum);
+    const auto expected = CicReference<SampleT, RatioV, StagesV>(samples);
+    std::vector<SampleT> outputs(expected.size() + 4);
+    const auto count = cic.Update(samples, outputs);
+    outputs.resize(count);
+    STM32_CHECK(outputs == expected);
+    STM32_CHECK(cic.Get() == expected.back());
+}
+
+void BenchmarkFilters()
+{
+    constexpr std::size_t block_size{4096};
+    const auto block = RandomSamples<std::uint16_t>(block_size, 0, 4095);
+    const std::span<const std::uint16_t> samples{block};
+
+    STM32::MovingAverage<std::uint16_t, STM32::FilterWindow<16>> average{};
+    STM32::Test::Benchmark("moving average 16", block_size, 2000, [&](){
+        STM32::Test::DoNotOptimize(average.Update(samples));
+    });
+    STM32::Ema<std::uint16_t, STM32::EmaShift<4>> ema{};
+    STM32::Test::Benchmark("ema shift 4", block_size, 2000, [&](){
+        STM32::Test::DoNotOptimize(ema.Update(samples));
+    });
+    STM32::RunningMedian<std::uint16_t, STM32::FilterWindow<31>> median{};
+    STM32::Test::Benchmark("running median 31", block_size, 500, [&](){
+        STM32::Test::DoNotOptimize(median.Update(samples));
+    });
+    STM32::CicDecimator<std::uint16_t, STM32::CicDecimation<16>, STM32::CicStages<3>> cic{};
+    std::array<std::uint16_t, block_size / 16> decimated{};
+    STM32::Test::Benchmark("cic 16x3", block_size, 2000, [&](){
+        STM32::Test::DoNotOptimize(cic.Update(samples, decimated));
+        STM32::Test::DoNotOptimize(decimated);
+    });
+}
+
+} /* namespace */
+
+int main()
+{
+    TestMovingAverage<std::uint16_t, 1>();
+    TestMovingAverage<std::uint16_t, 10>();
+    TestMovingAverage<std::uint16_t, 16>();
+    TestMovingAverage<std::int16_t, 7>();
+    TestMovingAverage<float, 32>();
+    TestMovingAverageDoesNotDrift();
+    TestEma<1>();
+    TestEma<4>();
+    TestEma<8>();
+    TestRunningMedian<std::uint16_t, 1>();
+    TestRunningMedian<std::uint16_t, 2>();
+    TestRunningMedian<std::uint16_t, 5>();
+    TestRunningMedian<std::uint16_t, 31>();
+    TestRunningMedian<std::uint16_t, 32>();
+    TestRunningMedian<float, 9>();
+    TestCicDecimator<std::uint16_t, 16, 3>(0, 4095);
+    TestCicDecimator<std::uint16_t, 5, 2>(0, 65535);
+    TestCicDecimator<std::int16_t, 8, 4>(-32768, 32767);
+    TestCicDecimator<std::int32_t, 3, 5>(-100000, 100000);
+    BenchmarkFilters();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,466 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file main.h, Host stand-in for the CubeMX generated main.h.
+ *
+ * Declares the subset of the STM32 HAL and CMSIS used by the library so the
+ * headers compile on the host. Peripherals under test keep their state in the
+ * handle: transfers are recorded instead of executed, and the tests complete
+ * or fail them with the Fake* helpers, which invoke the registered callbacks
+ * as the interrupt handlers would.
+ */
+
+#ifndef STM32_TESTS_FAKE_MAIN_H
+#define STM32_TESTS_FAKE_MAIN_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define HAL_ADC_MODULE_ENABLED
+#define USE_HAL_ADC_REGISTER_CALLBACKS 1
+#define HAL_DMA_MODULE_ENABLED
+#define HAL_GPIO_MODULE_ENABLED
+#define HAL_I2C_MODULE_ENABLED
+#define USE_HAL_I2C_REGISTER_CALLBACKS 1
+
+#define __DCACHE_PRESENT 1
+#define __FPU_PRESENT 0
+
+#define ENABLE 1U
+#define DISABLE 0U
+
+typedef enum {
+    HAL_OK = 0x00,
+    HAL_ERROR = 0x01,
+    HAL_BUSY = 0x02,
+    HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+/* CMSIS */
+
+inline std::uint32_t fake_primask{};
+
+inline std::uint32_t __get_PRIMASK() { return fake_primask; }
+inline void __set_PRIMASK(std::uint32_t primask) { fake_primask = primask; }
+inline void __disable_irq() { fake_primask = 1; }
+inline void __enable_irq() { fake_primask = 0; }
+inline void __DSB() {}
+inline void SCB_CleanDCache_by_Addr(volatile void*, std::int32_t) {}
+inline void SCB_InvalidateDCache_by_Addr(volatile void*, std::int32_t) {}
+
+inline std::uint32_t fake_tick{};
+
+inline std::uint32_t HAL_GetTick() { return fake_tick; }
+
+/* DMA */
+
+#define DMA_MINC_ENABLE 0x00000400U
+#define DMA_MINC_DISABLE 0x00000000U
+
+#define DMA_IT_TC 0x00000002U
+#define DMA_IT_HT 0x00000004U
+#define DMA_IT_TE 0x00000008U
+
+struct DMA_InitTypeDef {
+    std::uint32_t MemInc;
+    std::uint32_t Mode;
+};
+
+struct DMA_HandleTypeDef {
+    void* Instance;
+    DMA_InitTypeDef Init;
+
+    std::uint32_t FakeInterrupts;       /**< Enabled DMA_IT_* interrupts */
+};
+
+inline HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef*) { return HAL_OK; }
+
+#define __HAL_DMA_ENABLE_IT(handle, interrupt) ((handle)->FakeInterrupts |= (interrupt))
+#define __HAL_DMA_DISABLE_IT(handle, interrupt) ((handle)->FakeInterrupts &= ~(interrupt))
+
+/* ADC */
+
+#define HAL_ADC_ERROR_NONE 0x00U
+#define HAL_ADC_ERROR_OVR 0x02U
+#define HAL_ADC_ERROR_DMA 0x04U
+
+#define ADC_CHANNEL_1 0x00000001U
+#define ADC_ANALOGWATCHDOG_SINGLE_REG 0x00800200U
+#define ADC_IT_AWD 0x00000040U
+#define ADC_FLAG_AWD 0x00000001U
+
+typedef enum {
+    HAL_ADC_CONVERSION_COMPLETE_CB_ID,
+    HAL_ADC_CONVERSION_HALF_CB_ID,
+    HAL_ADC_LEVEL_OUT_OF_WINDOW_1_CB_ID,
+    HAL_ADC_ERROR_CB_ID,
+    FAKE_ADC_CB_ID_COUNT
+} HAL_ADC_CallbackIDTypeDef;
+
+struct ADC_HandleTypeDef;
+
+typedef void (*pADC_CallbackTypeDef)(ADC_HandleTypeDef*);
+
+struct ADC_InitTypeDef {
+    std::uint32_t ContinuousConvMode;
+    std::uint32_t ExternalTrigConv;
+    std::uint32_t ExternalTrigConvEdge;
+};
+
+struct ADC_AnalogWDGConfTypeDef {
+    std::uint32_t WatchdogMode;
+    std::uint32_t HighThreshold;
+    std::uint32_t LowThreshold;
+    std::uint32_t Channel;
+    std::uint32_t ITMode;
+};
+
+struct ADC_HandleTypeDef {
+    void* Instance;
+    ADC_InitTypeDef Init;
+    std::uint32_t ErrorCode;
+    DMA_HandleTypeDef* DMA_Handle;
+
+    pADC_CallbackTypeDef Callbacks[FAKE_ADC_CB_ID_COUNT];
+    HAL_StatusTypeDef FakeStartStatus;  /**< Returned by the next HAL_ADC_Start_DMA() */
+    bool FakeRunning;                   /**< DMA requests are served */
+    std::uint16_t* FakeBuffer;          /**< Circular DMA buffer of the last start */
+    std::uint32_t FakeLength;
+    std::uint32_t FakeStartCount;
+    std::uint32_t FakeValue;            /**< Returned by HAL_ADC_GetValue() */
+};
+
+inline HAL_StatusTypeDef HAL_ADC_RegisterCallback(
+    ADC_HandleTypeDef* handle, HAL_ADC_CallbackIDTypeDef id, pADC_CallbackTypeDef callback)
+{
+    handle->Callbacks[id] = callback;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_ADC_UnRegisterCallback(ADC_HandleTypeDef* handle, HAL_ADC_CallbackIDTypeDef id)
+{
+    handle->Callbacks[id] = nullptr;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef*, std::uint32_t) { return HAL_OK; }
+inline std::uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef* handle) { return handle->FakeValue; }
+inline HAL_StatusTypeDef HAL_ADC_AnalogWDGConfig(ADC_HandleTypeDef*, ADC_AnalogWDGConfTypeDef*) { return HAL_OK; }
+
+#define __HAL_ADC_ENABLE_IT(handle, interrupt) ((void)(handle), (void)(interrupt))
+#define __HAL_ADC_DISABLE_IT(handle, interrupt) ((void)(handle), (void)(interrupt))
+#define __HAL_ADC_CLEAR_FLAG(handle, flag) ((void)(handle), (void)(flag))
+
+inline HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* handle, std::uint32_t* data, std::uint32_t length)
+{
+    if (handle->FakeRunning) {
+        return HAL_BUSY;
+    }
+    if (handle->FakeStartStatus != HAL_OK) {
+        return handle->FakeStartStatus;
+    }
+    handle->ErrorCode = HAL_ADC_ERROR_NONE;
+    handle->FakeRunning = true;
+    handle->FakeBuffer = reinterpret_cast<std::uint16_t*>(data);
+    handle->FakeLength = length;
+    ++handle->FakeStartCount;
+    if (handle->DMA_Handle != nullptr) {
+        __HAL_DMA_ENABLE_IT(handle->DMA_Handle, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE);
+    }
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* handle)
+{
+    handle->FakeRunning = false;
+    return HAL_OK;
+}
+
+/**
+ * @brief Fill half of the circular buffer and raise its interrupt, as the DMA would.
+ *
+ * @param half      Half to fill (0 first, 1 second).
+ * @param samples   Conversions in order, FakeLength / 2 of them.
+ */
+inline void FakeAdcFillHalf(ADC_HandleTypeDef* handle, std::size_t half, const std::uint16_t* samples)
+{
+    const std::size_t half_length{handle->FakeLength / 2};
+    for (std::size_t i = 0; i < half_length; ++i) {
+        handle->FakeBuffer[half * half_length + i] = samples[i];
+    }
+    const auto id = (half == 0) ? HAL_ADC_CONVERSION_HALF_CB_ID : HAL_ADC_CONVERSION_COMPLETE_CB_ID;
+    if (auto callback = handle->Callbacks[id]) {
+        callback(handle);
+    }
+}
+
+/**
+ * @brief Raise an error, an overrun stops the DMA requests as on the hardware.
+ */
+inline void FakeAdcFail(ADC_HandleTypeDef* handle, std::uint32_t error = HAL_ADC_ERROR_OVR)
+{
+    handle->ErrorCode = error;
+    handle->FakeRunning = false;
+    if (auto callback = handle->Callbacks[HAL_ADC_ERROR_CB_ID]) {
+        callback(handle);
+    }
+}
+
+/* GPIO */
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+struct GPIO_TypeDef {
+    std::uint32_t IDR;
+    std::uint32_t ODR;
+};
+
+inline GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* port, std::uint16_t pin)
+{
+    return (port->IDR & pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+inline void HAL_GPIO_WritePin(GPIO_TypeDef* port, std::uint16_t pin, GPIO_PinState state)
+{
+    port->ODR = (state == GPIO_PIN_SET) ? (port->ODR | pin) : (port->ODR & ~std::uint32_t{pin});
+}
+
+inline void HAL_GPIO_TogglePin(GPIO_TypeDef* port, std::uint16_t pin)
+{
+    port->ODR ^= pin;
+}
+
+/* I2C */
+
+#define HAL_I2C_ERROR_NONE 0x00000000U
+#define HAL_I2C_ERROR_BERR 0x00000001U
+#define HAL_I2C_ERROR_ARLO 0x00000002U
+#define HAL_I2C_ERROR_AF 0x00000004U
+
+#define I2C_MEMADD_SIZE_8BIT 0x00000001U
+#define I2C_MEMADD_SIZE_16BIT 0x00000002U
+
+#define I2C_FIRST_FRAME 0x00000000U
+#define I2C_FIRST_AND_NEXT_FRAME 0x00000001U
+#define I2C_NEXT_FRAME 0x00000002U
+#define I2C_FIRST_AND_LAST_FRAME 0x00000003U
+#define I2C_LAST_FRAME 0x00000004U
+#define I2C_LAST_FRAME_NO_STOP 0x00000005U
+#define I2C_OTHER_FRAME 0x00000006U
+#define I2C_OTHER_AND_LAST_FRAME 0x00000007U
+
+#define I2C_DIRECTION_TRANSMIT 0x00000000U
+#define I2C_DIRECTION_RECEIVE 0x00000001U
+
+typedef enum {
+    HAL_I2C_MASTER_TX_COMPLETE_CB_ID,
+    HAL_I2C_MASTER_RX_COMPLETE_CB_ID,
+    HAL_I2C_SLAVE_TX_COMPLETE_CB_ID,
+    HAL_I2C_SLAVE_RX_COMPLETE_CB_ID,
+    HAL_I2C_LISTEN_COMPLETE_CB_ID,
+    HAL_I2C_MEM_TX_COMPLETE_CB_ID,
+    HAL_I2C_MEM_RX_COMPLETE_CB_ID,
+    HAL_I2C_ERROR_CB_ID,
+    HAL_I2C_ABORT_CB_ID,
+    FAKE_I2C_CB_ID_COUNT
+} HAL_I2C_CallbackIDTypeDef;
+
+struct I2C_HandleTypeDef;
+
+typedef void (*pI2C_CallbackTypeDef)(I2C_HandleTypeDef*);
+typedef void (*pI2C_AddrCallbackTypeDef)(I2C_HandleTypeDef*, std::uint8_t, std::uint16_t);
+
+struct I2C_InitTypeDef {
+    std::uint32_t OwnAddress1;
+    std::uint32_t AddressingMode;
+};
+
+/**
+ * @struct FakeI2cTransfer, A master transfer accepted by the fake I2C.
+ */
+struct FakeI2cTransfer {
+    HAL_I2C_CallbackIDTypeDef complete_id;
+    std::uint16_t device_address;
+    std::uint16_t memory_address;
+    std::uint8_t* data;
+    std::uint16_t size;
+    std::uint32_t options;
+};
+
+struct I2C_HandleTypeDef {
+    void* Instance;
+    I2C_InitTypeDef Init;
+    DMA_HandleTypeDef* hdmatx;
+    DMA_HandleTypeDef* hdmarx;
+    std::uint32_t ErrorCode;
+    std::uint16_t XferCount;
+    std::uint16_t XferSize;
+
+    pI2C_CallbackTypeDef Callbacks[FAKE_I2C_CB_ID_COUNT];
+    pI2C_AddrCallbackTypeDef AddrCallback;
+    HAL_StatusTypeDef FakeStartStatus;  /**< Returned by the next non-blocking start */
+    bool FakePending;
+    FakeI2cTransfer FakeTransfer;       /**< Last accepted transfer */
+    std::uint32_t FakeStartCount;
+    std::uint32_t FakeAbortCount;
+};
+
+inline HAL_StatusTypeDef HAL_I2C_RegisterCallback(
+    I2C_HandleTypeDef* handle, HAL_I2C_CallbackIDTypeDef id, pI2C_CallbackTypeDef callback)
+{
+    handle->Callbacks[id] = callback;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_UnRegisterCallback(I2C_HandleTypeDef* handle, HAL_I2C_CallbackIDTypeDef id)
+{
+    handle->Callbacks[id] = nullptr;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_RegisterAddrCallback(I2C_HandleTypeDef* handle, pI2C_AddrCallbackTypeDef callback)
+{
+    handle->AddrCallback = callback;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_UnRegisterAddrCallback(I2C_HandleTypeDef* handle)
+{
+    handle->AddrCallback = nullptr;
+    return HAL_OK;
+}
+
+inline std::uint32_t HAL_I2C_GetError(I2C_HandleTypeDef* handle) { return handle->ErrorCode; }
+
+/**
+ * @brief Record a non-blocking master transfer, or refuse it like the HAL.
+ */
+inline HAL_StatusTypeDef FakeI2cStart(I2C_HandleTypeDef* handle, const FakeI2cTransfer& transfer)
+{
+    if (handle->FakePending) {
+        return HAL_BUSY;
+    }
+    if (handle->FakeStartStatus != HAL_OK) {
+        return handle->FakeStartStatus;
+    }
+    handle->ErrorCode = HAL_I2C_ERROR_NONE;
+    handle->FakePending = true;
+    handle->FakeTransfer = transfer;
+    ++handle->FakeStartCount;
+    return HAL_OK;
+}
+
+/**
+ * @brief Finish the pending transfer successfully, as the transfer complete interrupt would.
+ */
+inline void FakeI2cComplete(I2C_HandleTypeDef* handle)
+{
+    handle->FakePending = false;
+    if (auto callback = handle->Callbacks[handle->FakeTransfer.complete_id]) {
+        callback(handle);
+    }
+}
+
+/**
+ * @brief Fail the pending transfer, as the error interrupt would.
+ */
+inline void FakeI2cFail(I2C_HandleTypeDef* handle, std::uint32_t error = HAL_I2C_ERROR_AF)
+{
+    handle->FakePending = false;
+    handle->ErrorCode = error;
+    if (auto callback = handle->Callbacks[HAL_I2C_ERROR_CB_ID]) {
+        callback(handle);
+    }
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef*, std::uint16_t, std::uint8_t*, std::uint16_t, std::uint32_t) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef*, std::uint16_t, std::uint8_t*, std::uint16_t, std::uint32_t) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef*, std::uint16_t, std::uint16_t, std::uint16_t, std::uint8_t*, std::uint16_t, std::uint32_t) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef*, std::uint16_t, std::uint16_t, std::uint16_t, std::uint8_t*, std::uint16_t, std::uint32_t) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef*, std::uint16_t, std::uint32_t, std::uint32_t) { return HAL_OK; }
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_TX_COMPLETE_CB_ID, address, 0, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_RX_COMPLETE_CB_ID, address, 0, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_TX_COMPLETE_CB_ID, address, 0, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_RX_COMPLETE_CB_ID, address, 0, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint16_t memory_address, std::uint16_t, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MEM_TX_COMPLETE_CB_ID, address, memory_address, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint16_t memory_address, std::uint16_t, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MEM_RX_COMPLETE_CB_ID, address, memory_address, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint16_t memory_address, std::uint16_t, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MEM_TX_COMPLETE_CB_ID, address, memory_address, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint16_t memory_address, std::uint16_t, std::uint8_t* data, std::uint16_t size)
+{
+    return FakeI2cStart(h, {HAL_I2C_MEM_RX_COMPLETE_CB_ID, address, memory_address, data, size, I2C_FIRST_AND_LAST_FRAME});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size, std::uint32_t options)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_TX_COMPLETE_CB_ID, address, 0, data, size, options});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_IT(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size, std::uint32_t options)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_RX_COMPLETE_CB_ID, address, 0, data, size, options});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size, std::uint32_t options)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_TX_COMPLETE_CB_ID, address, 0, data, size, options});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef* h, std::uint16_t address, std::uint8_t* data, std::uint16_t size, std::uint32_t options)
+{
+    return FakeI2cStart(h, {HAL_I2C_MASTER_RX_COMPLETE_CB_ID, address, 0, data, size, options});
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef* h, std::uint16_t)
+{
+    h->FakePending = false;
+    ++h->FakeAbortCount;
+    return HAL_OK;
+}
+
+/**
+ * @brief Finish an abort, as the interrupt after the STOP condition would.
+ */
+inline void FakeI2cAbortComplete(I2C_HandleTypeDef* handle)
+{
+    if (auto callback = handle->Callbacks[HAL_I2C_ABORT_CB_ID]) {
+        callback(handle);
+    }
+}
+
+#endif /* STM32_TESTS_FAKE_MAIN_H */
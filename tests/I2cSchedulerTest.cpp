@@ -0,0 +1,241 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file I2cSchedulerTest.cpp, Host simulation of I2cScheduler on the fake I2C.
+ *
+ * Transfers are completed or failed by hand, as the I2C interrupts would, and
+ * the tests check ordering, callback outcomes, periodic job throttling and the
+ * run-time DMA buffer checks.
+ */
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <STM32LibraryCollection/I2cScheduler.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+I2C_HandleTypeDef hi2c{};
+STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c};
+
+using Scheduler = STM32::I2cScheduler<
+    decltype(i2c), STM32::I2cSchedulerQueueSize<3>, STM32::I2cSchedulerJobCount<2>
+>;
+
+void Reset()
+{
+    hi2c.FakePending = false;
+    hi2c.FakeStartStatus = HAL_OK;
+    hi2c.FakeStartCount = 0;
+}
+
+void TestRunsInSubmissionOrder()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    std::vector<int> order{};
+    std::vector<bool> outcomes{};
+    static constexpr std::array<std::uint8_t, 2> command{0x10, 0x20};
+    STM32::DmaBuffer<std::uint8_t, 6> sample{};
+
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Write(0x10, command), [&](){
+        order.push_back(1);
+        outcomes.push_back(scheduler.LastTransferSucceeded());
+    }));
+    STM32_CHECK(scheduler.IsBusy());
+    STM32_CHECK(hi2c.FakeTransfer.device_address == (0x10 << 1));
+    STM32_CHECK(hi2c.FakeTransfer.size == command.size());
+
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::MemoryRead(0x68, 0x3B, STM32::I2cMemoryAddressSize::Bits8, sample.Span()), [&](){
+        order.push_back(2);
+        outcomes.push_back(scheduler.LastTransferSucceeded());
+    }));
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Read(0x20, sample.Span()), [&](){
+        order.push_back(3);
+        outcomes.push_back(scheduler.LastTransferSucceeded());
+    }));
+    STM32_CHECK(hi2c.FakeStartCount == 1);
+
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(hi2c.FakeTransfer.complete_id == HAL_I2C_MEM_RX_COMPLETE_CB_ID);
+    STM32_CHECK(hi2c.FakeTransfer.memory_address == 0x3B);
+    FakeI2cFail(&hi2c);
+    STM32_CHECK(hi2c.FakeTransfer.complete_id == HAL_I2C_MASTER_RX_COMPLETE_CB_ID);
+    FakeI2cComplete(&hi2c);
+
+    STM32_CHECK(!scheduler.IsBusy());
+    STM32_CHECK((order == std::vector<int>{1, 2, 3}));
+    STM32_CHECK((outcomes == std::vector<bool>{true, false, true}));
+}
+
+void TestRejectsWhenQueueIsFull()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    static constexpr std::array<std::uint8_t, 1> command{0x01};
+
+    /* One transfer runs, three wait */
+    for (int i = 0; i < 4; ++i) {
+        STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Write(0x10, command)));
+    }
+    STM32_CHECK(!scheduler.Submit(STM32::I2cTransfer::Write(0x10, command)));
+
+    for (int i = 0; i < 4; ++i) {
+        FakeI2cComplete(&hi2c);
+    }
+    STM32_CHECK(!scheduler.IsBusy());
+    STM32_CHECK(hi2c.FakeStartCount == 4);
+}
+
+void TestStartFailureMovesOn()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    static constexpr std::array<std::uint8_t, 1> command{0x01};
+    int failures{};
+
+    hi2c.FakeStartStatus = HAL_ERROR;
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Write(0x10, command), [&](){
+        failures += scheduler.LastTransferSucceeded() ? 0 : 1;
+    }));
+    STM32_CHECK(failures == 1);
+    STM32_CHECK(!scheduler.IsBusy());
+
+    hi2c.FakeStartStatus = HAL_OK;
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Write(0x10, command)));
+    STM32_CHECK(scheduler.IsBusy());
+    FakeI2cComplete(&hi2c);
+}
+
+void TestStartFailureAfterCompletionKeepsOrder()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    static constexpr std::array<std::uint8_t, 1> command{0x01};
+    std::vector<int> order{};
+    std::vector<bool> outcomes{};
+
+    for (int id : {1, 2}) {
+        STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::Write(0x10, command), [&, id](){
+            order.push_back(id);
+            outcomes.push_back(scheduler.LastTransferSucceeded());
+        }));
+    }
+
+    /* The second transfer is refused when started back to back with the first */
+    hi2c.FakeStartStatus = HAL_ERROR;
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK((order == std::vector<int>{1, 2}));
+    STM32_CHECK((outcomes == std::vector<bool>{true, false}));
+    STM32_CHECK(!scheduler.IsBusy());
+}
+
+void TestPeriodicJobsAreNotQueuedTwice()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    STM32::DmaBuffer<std::uint8_t, 2> sample{};
+    int runs{};
+
+    STM32_CHECK(!scheduler.AddPeriodic(0, STM32::I2cTransfer::Read(0x20, sample.Span())));
+    STM32_CHECK(scheduler.AddPeriodic(2, STM32::I2cTransfer::Read(0x20, sample.Span()), [&](){
+        ++runs;
+    }));
+
+    scheduler.Tick();
+    STM32_CHECK(!scheduler.IsBusy());
+    scheduler.Tick();
+    STM32_CHECK(scheduler.IsBusy());
+
+    /* The run is still on the bus when the job is due again */
+    scheduler.Tick();
+    scheduler.Tick();
+    STM32_CHECK(scheduler.GetSkippedJobCount() == 1);
+    STM32_CHECK(hi2c.FakeStartCount == 1);
+
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(runs == 1);
+    scheduler.Tick();
+    scheduler.Tick();
+    STM32_CHECK(hi2c.FakeStartCount == 2);
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(runs == 2);
+}
+
+void TestWriteThenReadUsesRepeatedStart()
+{
+    Reset();
+    Scheduler scheduler{i2c};
+    static constexpr std::array<std::uint8_t, 1> command{0xE7};
+    STM32::DmaBuffer<std::uint8_t, 3> response{};
+    int done{};
+
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::WriteThenRead(0x40, command, response.Span()), [&](){
+        done += scheduler.LastTransferSucceeded() ? 1 : 0;
+    }));
+    STM32_CHECK(hi2c.FakeTransfer.options == I2C_FIRST_FRAME);
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(hi2c.FakeTransfer.options == I2C_LAST_FRAME);
+    STM32_CHECK(hi2c.FakeTransfer.data == response.Span().data());
+    STM32_CHECK(done == 0);
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(done == 1);
+
+    /* The read cannot start after the write: the bus is released, then the transfer fails */
+    int failures{};
+    STM32_CHECK(scheduler.Submit(STM32::I2cTransfer::WriteThenRead(0x40, command, response.Span()), [&](){
+        failures += scheduler.LastTransferSucceeded() ? 0 : 1;
+    }));
+    hi2c.FakeStartStatus = HAL_ERROR;
+    hi2c.FakeAbortCount = 0;
+    FakeI2cComplete(&hi2c);
+    STM32_CHECK(hi2c.FakeAbortCount == 1);
+    STM32_CHECK(failures == 0);
+    STM32_CHECK(scheduler.IsBusy());
+    hi2c.FakeStartStatus = HAL_OK;
+    FakeI2cAbortComplete(&hi2c);
+    STM32_CHECK(failures == 1);
+    STM32_CHECK(!scheduler.IsBusy());
+}
+
+void TestRejectsUnpaddedReceiveSpan()
+{
+    Reset();
+    STM32::DmaBuffer<std::uint8_t, 2 * STM32::__Internal::__dcache_line_size> sample{};
+    auto unaligned = sample.Span().subspan(1, 4);
+    auto unpadded = sample.Span().first(4);
+    auto whole_lines = sample.Span().first(STM32::__Internal::__dcache_line_size);
+
+    /* Transactions only take spans that keep the DmaBuffer padding guarantee */
+    static_assert(!std::is_invocable_v<decltype(&STM32::I2cTransfer::Read), std::uint16_t, std::span<std::uint8_t>>);
+    static_assert(std::is_invocable_v<decltype(&STM32::I2cTransfer::Read), std::uint16_t, STM32::DmaSpan<std::uint8_t>>);
+
+    /* A plain span shares its first or last cache line with other data */
+    STM32_CHECK(!i2c.ReceiveTo(0x20, unaligned));
+    STM32_CHECK(!i2c.ReceiveTo(0x20, unpadded));
+    STM32_CHECK(hi2c.FakeStartCount == 0);
+
+    /* It is accepted when it covers whole cache lines */
+    STM32_CHECK(i2c.ReceiveTo(0x20, whole_lines));
+    STM32_CHECK(hi2c.FakeStartCount == 1);
+}
+
+} /* namespace */
+
+int main()
+{
+    TestRunsInSubmissionOrder();
+    TestRejectsWhenQueueIsFull();
+    TestStartFailureMovesOn();
+    TestStartFailureAfterCompletionKeepsOrder();
+    TestPeriodicJobsAreNotQueuedTwice();
+    TestWriteThenReadUsesRepeatedStart();
+    TestRejectsUnpaddedReceiveSpan();
+    return STM32::Test::Result();
+}
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file MedianTest.cpp, Correctness and throughput of the median selection networks.
+ *
+ * Every odd size from 3 to 25 is checked against std::ranges::nth_element on
+ * random and partially filled inputs, the specialized networks against all
+ * 0-1 inputs, and the rate of each size is compared with nth_element.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <utility>
+
+#include <STM32LibraryCollection/__Internal/__Median.hpp>
+
+#include "Check.hpp"
+
+namespace {
+
+using STM32::__Internal::__Median;
+using STM32::__Internal::__MedianNetwork;
+
+std::mt19937 generator{42};
+
+/**
+ * @returns True if the network selects the median of all 2^SizeV 0-1 inputs.
+ *
+ * Each bit of a word is one input vector, so min and max are AND and OR.
+ */
+template <std::size_t SizeV>
+bool SelectsMedianOfAllBinaryInputs()
+{
+    constexpr std::uint64_t vector_count{std::uint64_t{1} << SizeV};
+    for (std::uint64_t first{}; first < vector_count; first += 64) {
+        std::array<std::uint64_t, SizeV> lanes{};
+        std::uint64_t expected{};
+        for (std::uint64_t bit{}; bit < 64 && first + bit < vector_count; ++bit) {
+            const auto vector = first + bit;
+            for (std::size_t input{}; input < SizeV; ++input) {
+                lanes[input] |= ((vector >> input) & 1) << bit;
+            }
+            /* The middle of the sorted vector is one if at most SizeV / 2 inputs are zero */
+            if (static_cast<std::size_t>(std::popcount(vector)) >= SizeV - SizeV / 2) {
+                expected |= std::uint64_t{1} << bit;
+            }
+        }
+        for (const auto& [lower, upper] : __MedianNetwork<SizeV>::pairs) {
+            const auto minimum = lanes[lower] & lanes[upper];
+            lanes[upper] |= lanes[lower];
+            lanes[lower] = minimum;
+        }
+        const std::uint64_t valid{(vector_count - first >= 64) ?
+            ~std::uint64_t{} : (std::uint64_t{1} << (vector_count - first)) - 1};
+        if ((lanes[SizeV / 2] & valid) != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @returns Median of the first filled_size values by nth_element.
+ */
+template <std::size_t SizeV>
+std::uint16_t Reference(std::array<std::uint16_t, SizeV> values, std::size_t filled_size)
+{
+    const auto middle = values.begin() + filled_size / 2;
+    std::ranges::nth_element(values.begin(), middle, values.begin() + filled_size);
+    return *middle;
+}
+
+template <std::size_t SizeV>
+void TestMatchesReference()
+{
+    std::uniform_int_distribution<int> sample{0, 4095};
+    for (int round{}; round < 2000; ++round) {
+        std::array<std::uint16_t, SizeV> values{};
+        for (auto& value : values) {
+            value = static_cast<std::uint16_t>(sample(generator));
+        }
+        const std::size_t filled_size{1 + static_cast<std::size_t>(round) % SizeV};
+        const auto expected = Reference(values, filled_size);
+        STM32_CHECK(__Median(values, filled_size) == expected);
+    }
+}
+
+template <std::size_t SizeV>
+void BenchmarkSize()
+{
+    constexpr std::size_t set_count{1024};
+    std::uniform_int_distribution<int> sample{0, 4095};
+    std::array<std::array<std::uint16_t, SizeV>, set_count> sets{};
+    for (auto& set : sets) {
+        for (auto& value : set) {
+            value = static_cast<std::uint16_t>(sample(generator));
+        }
+    }
+    char network_name[32]{};
+    char reference_name[32]{};
+    std::snprintf(network_name, sizeof(network_name), "median %2zu network", SizeV);
+    std::snprintf(reference_name, sizeof(reference_name), "median %2zu nth_element", SizeV);
+    const double network_rate = STM32::Test::Benchmark(network_name, set_count, 200, [&](){
+        for (auto set : sets) {
+            STM32::Test::DoNotOptimize(__Median(set, SizeV));
+        }
+    });
+    const double reference_rate = STM32::Test::Benchmark(reference_name, set_count, 200, [&](){
+        for (auto set : sets) {
+            const auto middle = set.begin() + SizeV / 2;
+            std::ranges::nth_element(set.begin(), middle, set.end());
+            STM32::Test::DoNotOptimize(*middle);
+        }
+    });
+    std::printf("%-32s %12.2fx, %zu compare-exchanges\n", "", network_rate / reference_rate,
+        __MedianNetwork<SizeV>::pairs.size());
+}
+
+} /* namespace */
+
+int main()
+{
+    STM32_CHECK(__MedianNetwork<3>::pairs.size() == 3);
+    STM32_CHECK(__MedianNetwork<5>::pairs.size() == 7);
+    STM32_CHECK(__MedianNetwork<7>::pairs.size() == 13);
+    STM32_CHECK(__MedianNetwork<9>::pairs.size() == 19);
+    STM32_CHECK(__MedianNetwork<25>::pairs.size() == 99);
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<3>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<5>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<7>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<9>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<11>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<15>());
+    STM32_CHECK(SelectsMedianOfAllBinaryInputs<25>());
+
+    [&]<std::size_t... I>(std::index_sequence<I...>){
+        (TestMatchesReference<3 + 2 * I>(), ...);
+        (BenchmarkSize<3 + 2 * I>(), ...);
+    }(std::make_index_sequence<12>{});
+    return STM32::Test::Result();
+}